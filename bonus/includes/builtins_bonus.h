@@ -15,9 +15,67 @@
 
 //message
 # define ERROR_IDENTIFIER "export: `%s': not a valid identifier"
+# define DECLARE_IDENTIFIER "declare: `%s': not a valid identifier"
+# define MAPFILE_IDENTIFIER "mapfile: `%s': not a valid identifier"
+# define ASSOC_SUBSCRIPT "%s: %s: must use subscript when assigning \
+associative array"
+# define BUILTINS ":cd:pwd:export:unset:exit:echo:env:declare:mapfile:\
+readarray:hash:enable:set:wait:jobs:kill:parallel:xargs:"
+# define ENABLE_USAGE "enable: usage: enable [-f filename name...] [-d name...]"
+# define SET_USAGE "set: usage: set [-o option-name] [+o option-name]"
+# define WAIT_USAGE "wait: usage: wait [-n] [id ...]"
+# define WAIT_SPEC "wait: `%s': not a pid or valid job spec"
+# define JOBS_USAGE "jobs: usage: jobs [-lp] [jobspec ...]"
+# define KILL_USAGE "kill: usage: kill [-s sigspec | -n signum | -sigspec] \
+pid | jobspec ... or kill -l [sigspec]"
+# define KILL_TARGET "kill: %s: arguments must be process or job IDs"
+# define PARALLEL_USAGE "parallel: usage: parallel [-j jobs] [command ...]"
+# define XARGS_USAGE "xargs: usage: xargs [-0r] [-n max-args] [-P max-procs] \
+[command [initial-arguments]]"
+# define XARGS_TOO_LONG "xargs: argument line too long"
+# define XARGS_ABORT "xargs: %s: exited with status 255; aborting"
+# define XARGS_KILLED "xargs: %s: terminated by signal %d"
+# define XARGS_BUFFER 131072
+# define XARGS_HEADROOM 2048
+# define XARGS_STRLEN 131072
+# define SIGNAL_NAMES "HUP INT QUIT ILL TRAP ABRT BUS FPE KILL USR1 SEGV USR2 \
+PIPE ALRM TERM STKFLT CHLD CONT STOP TSTP TTIN TTOU URG XCPU XFSZ VTALRM PROF \
+WINCH IO PWR SYS"
 
 typedef struct s_shell	t_shell;
 typedef enum e_env		t_env;
+typedef struct s_array	t_array;
+typedef struct s_job	t_job;
+
+typedef struct s_xargs
+{
+	char	*buf;
+	size_t	len;
+	size_t	cap;
+	size_t	pos;
+	size_t	scan;
+	bool	eof;
+	bool	nul;
+	bool	no_empty;
+	bool	stop;
+	char	**cmd;
+	char	**envp;
+	char	*path;
+	size_t	*hits;
+	size_t	limit;
+	size_t	cost;
+	int		n;
+	int		max_args;
+	int		procs;
+	int		status;
+	t_list	*jobs;
+}	t_xargs;
+
+typedef struct s_enabled
+{
+	t_loadable	*ld;
+	void		*handle;
+}	t_enabled;
 
 /* ft_env_bonus.c */
 
@@ -36,6 +94,51 @@ int			ft_echo(char **args);
 
 int			ft_pwd(void);
 
+/* ft_set_bonus.c */
+
+int			ft_set(int argc, char **argv, t_shell *sh);
+
+/* ft_wait_bonus.c */
+
+int			ft_wait(int argc, char **argv, t_shell *sh);
+
+/* ft_wait_utils_bonus.c */
+
+bool		ft_bg_poll(t_job *job, int options);
+t_job		*ft_wait_job(t_job *target, t_list *jobs);
+
+/* ft_jobs_bonus.c */
+
+void		ft_jobs_print(t_job *job, bool pid, FILE *out, t_shell *sh);
+int			ft_jobs(int argc, char **argv, t_shell *sh);
+
+/* ft_kill_bonus.c */
+
+int			ft_kill(int argc, char **argv, t_shell *sh);
+
+/* ft_kill_utils_bonus.c */
+
+int			ft_kill_signum(char *spec);
+int			ft_kill_list(char **args);
+
+/* ft_parallel_bonus.c */
+
+int			ft_parallel(int argc, char **argv, t_shell *sh);
+
+/* ft_xargs_bonus.c */
+
+int			ft_xargs(int argc, char **argv, t_shell *sh);
+
+/* ft_xargs_utils_bonus.c */
+
+size_t		ft_xargs_limit(char **envp, char **cmd);
+int			ft_xargs_count(t_xargs *x);
+char		**ft_xargs_batch(t_xargs *x);
+
+/* ft_xargs_run_bonus.c */
+
+bool		ft_xargs_run(t_xargs *x);
+
 /* ft_unset_bonus.c */
 
 int			ft_unset(int argc, char **argv, t_shell *sh);
@@ -73,12 +176,44 @@ int			delete_var_limbo(char *str, char ***envp, size_t size_env);
 
 void		ft_sort_str_tab(char **str, int n);
 void		ft_print_export(char **envp);
+void		ft_assign_local(char *arg, t_shell *sh);
+
+/* ft_array_assign_bonus.c */
+
+bool		ft_array_assign(char *arg, t_shell *sh);
+
+/* ft_array_assign_utils_bonus.c */
+
+int			ft_array_form(char *s);
+void		ft_array_elem(t_array *arr, char *rest, t_shell *sh);
+bool		ft_array_scalar(char *arg, int len, t_shell *sh);
+
+/* ft_declare_bonus.c */
+
+int			ft_declare(int argc, char **argv, t_shell *sh);
+int			ft_mapfile(int argc, char **argv, t_shell *sh);
+
+/* ft_hash_bonus.c */
+
+int			ft_hash(int argc, char **argv, t_shell *sh);
+
+/* ft_enable_bonus.c */
+
+int			ft_enable(int argc, char **argv, t_shell *sh);
+
+/* ft_enable_utils_bonus.c */
+
+t_loadable	*ft_loadable_find(char *name, t_shell *sh);
+bool		ft_loadable_run(int argc, char **args, t_shell *sh);
+void		ft_enabled_free(void *content);
+bool		ft_enable_delete(char *name, t_shell *sh);
 
 /* builtins_utils_bonus.c */
 
-bool		ft_isbuiltin(char **args);
+bool		ft_isbuiltin(char **args, t_shell *sh);
 void		ft_exec_builtin(char **args, t_shell *sh);
 int			ft_argslen(char **args);
 int			ft_isjustbuiltin(void *node, t_shell *sh);
+void		ft_exec_builtin_ext(int argc, char **args, t_shell *sh);
 
 #endif //BUILTINS_BONUS_H
\ No newline at end of file
@@ -13,6 +13,19 @@
 #ifndef EXECUTION_BONUS_H
 # define EXECUTION_BONUS_H
 
+# define CMDSUB_BUFFER 4096
+# define PROCSUB_PATH "/dev/fd/"
+# define SAVE_STDIN 1
+# define SAVE_STDOUT 2
+# define SAVE_STDERR 4
+# define SAVE_ALL 7
+# define SAVED_FD_MIN 10
+# define ZYGOTE_FDS 4
+# define ZYGOTE_CTL CMSG_SPACE(sizeof(int) * ZYGOTE_FDS)
+# define ZYGOTE_LOST "zygote: helper lost, spawning commands directly"
+# define HEREDOC_EOF "warning: here-document at line %d delimited by "\
+	"end-of-file (wanted `%s')"
+
 typedef enum e_signal
 {
 	PARENT_,
@@ -22,32 +35,137 @@ typedef enum e_signal
 	DEFAULT_
 }	t_signal;
 
+typedef struct s_procsub
+{
+	int		fd;
+	pid_t	pid;
+}	t_procsub;
+
+typedef struct s_stage
+{
+	pid_t	pid;
+	int		status;
+}	t_stage;
+
+typedef struct s_job
+{
+	int		id;
+	pid_t	pid;
+	int		status;
+	bool	done;
+	char	*cmd;
+}	t_job;
+
+typedef struct s_slot
+{
+	pid_t	pid;
+	int		fd;
+	char	*buf;
+	size_t	len;
+	size_t	cap;
+}	t_slot;
+
+typedef struct s_batch
+{
+	char			**cmds;
+	size_t			next;
+	t_slot			*slots;
+	struct pollfd	*pfds;
+	int				size;
+	int				running;
+	int				failed;
+}	t_batch;
+
+typedef struct s_hentry
+{
+	char			*key;
+	char			*value;
+	size_t			hits;
+	struct s_hentry	*next;
+}	t_hentry;
+
+typedef struct s_hmap
+{
+	t_hentry	**buckets;
+	size_t		size;
+	size_t		count;
+}	t_hmap;
+
+typedef struct s_plan
+{
+	char	*path;
+	char	**argv;
+	char	**words;
+	char	**envp;
+	size_t	*hits;
+	int		io[2];
+}	t_plan;
+
+typedef struct s_zreq
+{
+	size_t	len;
+	int		argc;
+	int		envc;
+}	t_zreq;
+
+typedef struct s_zmsg
+{
+	struct msghdr	msg;
+	struct iovec	iov;
+	char			ctl[ZYGOTE_CTL];
+}	t_zmsg;
+
 typedef struct s_shell
 {
-	int		stdin_;
-	int		stdout_;
-	int		stderr_;
-	int		fds_saved;
-	int		error_fd;
-	int		fds[2];
-	t_node	*prev;
-	t_list	**heredoc_list;
-	char	**global;
-	char	**local;
-	char	**limbo;
-	int		run;
-	int		search_heredoc;
-	t_node	*next_node;
-	t_node	*prev_nnode;
-	void	*root;
+	int				stdin_;
+	int				stdout_;
+	int				stderr_;
+	int				fds_saved;
+	int				error_fd;
+	int				fds[2];
+	t_node			*prev;
+	t_list			**heredoc_list;
+	char			**global;
+	char			**local;
+	char			**limbo;
+	int				run;
+	int				search_heredoc;
+	t_node			*next_node;
+	t_node			*prev_nnode;
+	void			*root;
+	t_list			*procsub;
+	struct timespec	start;
+	pid_t			pid;
+	pid_t			last_bg;
+	unsigned int	seed;
+	char			dynvar[32];
+	t_list			*arrays;
+	t_hmap			hash;
+	t_hmap			warm;
+	char			*hash_path;
+	bool			tail;
+	t_list			*loaded;
+	int				status;
+	int				line;
+	int				tmp_count;
+	jmp_buf			*exit_jmp;
+	t_list			*stages;
+	bool			pipefail;
+	t_list			*jobs;
+	bool			expand_fail;
+	bool			split;
+	char			**elems;
+	t_list			*fields;
+	bool			subst;
+	int				zygote;
 }	t_shell;
 
 /* ft_heredoc_utils_bonus.c */
 
-void	ft_handle_quotes_hd(char **new_value, char *value, int *i, char **envp);
-char	*ft_expand_input(char *input, char **envp);
-char	*ft_create_pathname(void);
-int		count_line(int mode);
+void	ft_handle_quotes_hd(char **new_value, char *value, int *i, t_shell *sh);
+char	*ft_expand_input(char *input, t_shell *sh);
+char	*ft_create_pathname(t_shell *sh);
+int		count_line(t_shell *sh, int mode);
 void	ft_heredoc_manager(void *tree, t_shell *sh);
 
 /* ft_heredoc_bonus.c */
@@ -61,6 +179,8 @@ int		ft_redir(t_redir *nd, t_shell *sh);
 /* ft_redir_utils_bonus.c */
 
 bool	ft_is_star(char *s);
+int		ft_redirects_stdio(t_node *node);
+int		ft_redir_plan(t_node *node);
 
 /* ft_launcher_bonus.c */
 
@@ -71,31 +191,162 @@ void	ft_launcher_manager(void *tree, t_shell *sh);
 /* ft_launcher_utils_bonus.c */
 
 void	ft_restore_original_fds(t_shell *sh);
-void	ft_save_original_fds(t_shell *sh);
+void	ft_save_original_fds(t_shell *sh, int mask);
 void	close_original_fds(t_shell *sh);
 void	close_fds(int *fds);
 void	ft_issubroot(t_node *node, t_shell *sh);
 
 /* ft_exec_bonus.c */
 
-int		ft_exec(t_list **args, t_shell *sh);
+int		ft_exec(t_exec *exec, t_shell *sh);
 
 /* ft_exec_utils_bonus.c */
 
 int		ft_single_command(t_node *node, t_shell *sh);
-char	**ft_add_to_vector(char **old_vector, char *new_str);
 
 /* ft_exec_ultimate_bonus.c */
 
-int		ft_free_paths(char **paths, int i);
 int		isvalid_dir(char *pathname, char **args, t_shell *sh);
-int		isvalid_file(char *pathname, char **args, t_shell *sh);
+int		isvalid_file(char *pathname);
 char	*merge(char *s1, char *s2);
 
+/* ft_cmdsub_bonus.c */
+
+void	ft_cmdsub_child(char *body, int fd, int target, t_shell *sh);
+char	*ft_expand_cmdsub(char *value, int *i, t_shell *sh);
+
+/* ft_cmdsub_spawn_bonus.c */
+
+pid_t	ft_cmdsub_spawn(char *body, int *fds, t_shell *sh);
+
+/* ft_cmdsub_utils_bonus.c */
+
+char	*ft_grow_buffer(char *buf, size_t len, size_t *cap);
+char	*ft_read_all(int fd, size_t *len);
+char	*ft_read_fd(int fd);
+char	*ft_cmdsub_target(char *body);
+
+/* ft_procsub_bonus.c */
+
+char	*ft_expand_procsub(char *value, int *i, t_shell *sh);
+
+/* ft_procsub_utils_bonus.c */
+
+void	ft_procsub_close(t_shell *sh);
+void	ft_procsub_reap(t_shell *sh);
+
+/* ft_job_bonus.c */
+
+void	ft_job_add(t_shell *sh, pid_t pid);
+int		ft_job_code(int status);
+bool	ft_job_wait(t_shell *sh);
+void	ft_job_finish(t_shell *sh);
+
+/* ft_background_bonus.c */
+
+bool	ft_background(t_node *root, t_shell *sh);
+
+/* ft_background_utils_bonus.c */
+
+t_job	*ft_bg_add(t_shell *sh, pid_t pid, char *cmd);
+t_job	*ft_bg_find(char *spec, t_shell *sh);
+void	ft_bg_free(void *content);
+void	ft_bg_remove(t_list **jobs, t_job *job);
+void	ft_bg_notify(t_shell *sh);
+
+/* ft_batch_bonus.c */
+
+int		ft_batch_run(char **cmds, int size, t_shell *sh);
+
+/* ft_batch_utils_bonus.c */
+
+bool	ft_batch_read(t_slot *slot);
+int		ft_batch_finish(t_slot *slot);
+
+/* ft_job_text_bonus.c */
+
+char	*ft_job_text(t_node *root, t_node *stop);
+
+/* ft_prefix_env_bonus.c */
+
+int		ft_overlay_index(char **vector, char *word);
+char	*ft_env_value(char **env, char *key);
+char	**ft_overlay_env(char **env, char **words);
+char	**ft_assign_words(t_list **assigns, t_shell *sh);
+
+/* ft_prefix_env_utils_bonus.c */
+
+void	ft_prefix_builtin(char **args, char **words, t_shell *sh);
+int		ft_env_command(char **args);
+bool	ft_env_prefix(char ***args, char ***words);
+
+/* ft_path_hash_bonus.c */
+
+char	*ft_path_search(char *name, char *path);
+size_t	*ft_hash_lookup(char *name, t_shell *sh);
+char	*ft_hash_find(char *name, char **envp, t_shell *sh);
+void	ft_hash_prefetch(t_exec *exec, t_shell *sh);
+
+/* ft_path_hash_utils_bonus.c */
+
+bool	ft_hash_same(char *path, t_shell *sh);
+void	ft_hash_clear(t_shell *sh);
+void	ft_hash_sync(char *path, t_shell *sh);
+void	ft_hash_warm(char *name, t_shell *sh);
+
+/* ft_spawn_bonus.c */
+
+int		ft_spawn_actions(posix_spawn_file_actions_t *fa, int *fds, bool out);
+pid_t	ft_spawn_run(t_plan *plan, posix_spawn_file_actions_t *fa);
+pid_t	ft_spawn_command(int *fds, t_shell *sh, void *node, void *next_node);
+
+/* ft_zygote_bonus.c */
+
+int		ft_zygote_start(int *argc, char ***argv);
+int		ft_zygote_spawn(t_plan *plan, pid_t *pid);
+
+/* ft_zygote_helper_bonus.c */
+
+void	ft_zygote(int sock);
+
+/* ft_zygote_utils_bonus.c */
+
+void	ft_zygote_msg(t_zmsg *zm, t_zreq *req, int *fds);
+char	*ft_zygote_pack(t_plan *plan, t_zreq *req);
+char	**ft_zygote_args(t_zreq *req, char *data);
+bool	ft_zygote_io(int fd, void *buf, size_t len, bool out);
+
+/* ft_spawn_utils_bonus.c */
+
+bool	ft_pipe_output(void *next_node, t_shell *sh);
+bool	ft_plan_build(t_plan *plan, t_exec *exec, t_shell *sh);
+void	ft_plan_free(t_plan *plan);
+
+/* ft_tail_call_bonus.c */
+
+void	ft_launcher_tail(t_node *root, t_shell *sh);
+void	ft_exec_tail(void *node, t_shell *sh);
+
+/* ft_pipeline_bonus.c */
+
+bool	ft_pipeline(t_node *node, t_shell *sh);
+
+/* ft_pipeline_utils_bonus.c */
+
+bool	ft_pipeline_simple(t_node *node);
+
+/* ft_argv_bonus.c */
+
+bool	ft_argv_init(t_argv *argv, size_t cap);
+void	ft_argv_push(t_argv *argv, char *str);
+void	ft_argv_glob(t_argv *argv, char *word, bool glob);
+
 /* ft_tokentostring_bonus.c */
 
+char	**ft_tokens_argv(t_list **args, bool move);
 char	**tokentostring(t_list **args);
 
+void	ft_exec_subroot(void *node, t_shell *sh);
 void	ft_launcher_subroot(void *node, void *next_node, t_shell *sh);
 
 #endif //EXECUTION_BONUS_H
\ No newline at end of file
@@ -0,0 +1,39 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   libminishell_bonus.h                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: joneves- <joneves-@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by joneves-          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by joneves-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef LIBMINISHELL_BONUS_H
+# define LIBMINISHELL_BONUS_H
+
+/*
+ * Interface of `libminishell.a`, the shell engine without its prompt.
+ *
+ * Each context holds its own variables, exit status and counters, so several
+ * of them can live in one process and be driven from different threads. The
+ * working directory, the standard streams and the signal dispositions are
+ * process-wide, so runs are serialized: `msh_run` holds a process-wide lock
+ * while a command executes. Commands read and write the process's standard
+ * streams, and `exit` ends the current run instead of the host process.
+ */
+
+typedef struct s_shell	t_shell;
+
+/* ft_msh_bonus.c */
+
+int		msh_run(t_shell *sh, const char *cmd);
+
+/* ft_msh_utils_bonus.c */
+
+t_shell	*msh_create(char **envp);
+int		msh_status(t_shell *sh);
+void	msh_destroy(t_shell *sh);
+
+#endif //LIBMINISHELL_BONUS_H
@@ -0,0 +1,44 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   loadable_bonus.h                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: joneves- <joneves-@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by joneves-          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by joneves-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef LOADABLE_BONUS_H
+# define LOADABLE_BONUS_H
+
+/*
+ * Interface of the builtins loaded with `enable -f lib.so name`.
+ *
+ * A module is a shared object exporting, for each builtin `name`, a
+ * `t_loadable` called `name_loadable`. Its function is called like `main`,
+ * with the shell passed along for the accessors below, and returns the exit
+ * status of the builtin. Modules only include this header, and must be
+ * rebuilt when `LOADABLE_ABI` changes.
+ */
+# define LOADABLE_ABI 1
+
+typedef struct s_shell	t_shell;
+
+typedef int				(*t_ldfunc)(int argc, char **argv, t_shell *sh);
+
+typedef struct s_loadable
+{
+	int			abi;
+	const char	*name;
+	t_ldfunc	func;
+}	t_loadable;
+
+/* ft_loadable_abi_bonus.c */
+
+char	*ft_ld_getvar(t_shell *sh, char *name);
+int		ft_ld_setvar(t_shell *sh, char *name, char *value);
+int		ft_ld_status(void);
+
+#endif //LOADABLE_BONUS_H
@@ -13,6 +13,11 @@
 #ifndef MINISHELL_BONUS_H
 # define MINISHELL_BONUS_H
 
+// pipe2
+# ifndef _GNU_SOURCE
+#  define _GNU_SOURCE
+# endif
+
 // system libraries
 # include <unistd.h>
 # include <stdlib.h>
@@ -32,9 +37,21 @@
 # include <curses.h>
 # include <term.h>
 # include <limits.h>
+# include <time.h>
+# include <spawn.h>
+# include <sys/socket.h>
+# include <sys/un.h>
+# include <dlfcn.h>
+# include <setjmp.h>
+# include <pthread.h>
+# include <poll.h>
+# include <sched.h>
+# include <sys/syscall.h>
 
 // our own libraries
 # include "../../libft/libft.h"
+# include "loadable_bonus.h"
+# include "libminishell_bonus.h"
 # include "builtins_bonus.h"
 # include "tokenize_bonus.h"
 # include "execution_bonus.h"
@@ -49,6 +66,26 @@
 //messages
 # define MALLOC "memory allocation failed"
 # define ERROR_INIT "arguments are not accepted when initializing the program"
+# define BAD_SUBSCRIPT "%s: bad array subscript"
+# define ARRAY_RANGE "%s: array index out of range"
+
+//arrays
+# define ARRAY_ELEM 1
+# define ARRAY_LIST 2
+# define ARRAY_SIZE 8
+# define ARRAY_MAX 1048576
+# define HMAP_SIZE 16
+
+//server mode
+# define SERVE_BACKLOG 16
+# define SERVE_CTL CMSG_SPACE(sizeof(int) * 3)
+# define SERVE_TIMEOUT 5
+# define SERVE_TIMEDOUT "request timed out"
+# define SERVE_RUNNING "a server is already running"
+
+//speculative resolution
+# define SPEC_OPS "<>|&();"
+# define SPEC_SKIP "'\"$*?[~=\\`{"
 
 # define TRUE 1
 # define FALSE 0
@@ -61,6 +98,17 @@ typedef enum e_env
 	DEFAULT
 }	t_env;
 
+typedef struct s_array
+{
+	char	*name;
+	bool	assoc;
+	char	**items;
+	size_t	len;
+	size_t	cap;
+	size_t	count;
+	t_hmap	map;
+}	t_array;
+
 /* ft_free_utils_bonus.c */
 
 void	ft_free_vector(char **vector);
@@ -72,6 +120,9 @@ void	ft_child_cleaner(t_shell *sh, char **args, int mode);
 /* ft_exit_status_bonus.c */
 
 int		ft_exit_status(int exit_status, int write_, int exit_);
+t_shell	*ft_current_shell(t_shell *sh, int write_);
+void	ft_shell_detach(t_shell *sh);
+bool	ft_embedded(t_shell *sh);
 
 /* ft_error_handler_bonus.c */
 
@@ -95,10 +146,76 @@ void	ft_cli(t_shell *sh);
 t_shell	*ft_init_sh(char **envp);
 void	ft_restore_cli(t_shell *sh);
 
+/* ft_serve_bonus.c */
+
+void	ft_serve(char *path, t_shell *sh);
+int		ft_serve_client(char *path, char *cmd);
+
+/* ft_serve_socket_bonus.c */
+
+int		ft_serve_socket(char *path, bool server);
+bool	ft_send_stdio(int fd);
+bool	ft_recv_stdio(int fd, int fds[3]);
+
+/* ft_serve_utils_bonus.c */
+
+void	ft_serve_stdio(int fds[3], bool keep);
+bool	ft_serve_save(int saved[3]);
+int		ft_serve_accept(int fd);
+void	ft_close_rights(struct cmsghdr *cmsg);
+
+/* ft_speculate_bonus.c */
+
+t_shell	*ft_speculate_shell(t_shell *sh);
+int		ft_speculate(void);
+
 /* ft_env_manager_bonus.c */
 
 char	**ft_get_my_envp(char **envp);
 char	**ft_merge_env(char **env1, char **env2);
+char	*ft_getvar(char *key, size_t len, t_shell *sh);
+
+/* ft_hmap_bonus.c */
+
+size_t	ft_hmap_hash(char *key);
+int		ft_hmap_set(t_hmap *map, char *key, char *value);
+
+/* ft_hmap_utils_bonus.c */
+
+char	*ft_hmap_get(t_hmap *map, char *key);
+size_t	*ft_hmap_hits(t_hmap *map, char *key);
+void	ft_hmap_del(t_hmap *map, char *key);
+
+/* ft_hmap_utils2_bonus.c */
+
+void	ft_hmap_clear(t_hmap *map);
+size_t	ft_hmap_values(t_hmap *map, char **values);
+
+/* ft_array_bonus.c */
+
+int		ft_array_set(t_array *arr, char *key, char *value, t_shell *sh);
+int		ft_array_push(t_array *arr, char *value);
+char	*ft_array_get(t_array *arr, char *key, t_shell *sh);
+
+/* ft_array_utils_bonus.c */
+
+t_array	*ft_array_find(char *name, size_t len, t_shell *sh);
+t_array	*ft_array_new(char *name, size_t len, bool assoc, t_shell *sh);
+void	ft_array_clear(t_array *arr);
+void	ft_array_free(void *content);
+void	ft_array_unset(char *arg, t_shell *sh);
+
+/* ft_array_utils2_bonus.c */
+
+char	**ft_array_values(t_array *arr);
+char	*ft_array_join(t_array *arr, char sep);
+char	*ft_array_first(t_array *arr);
+void	ft_array_unset_elem(t_array *arr, char *sub, t_shell *sh);
+
+/* ft_dynamic_var_bonus.c */
+
+char	*ft_dynamic_var(char *key, size_t len, t_shell *sh);
+void	ft_dynamic_init(t_shell *sh);
 
 /* ft_copy_list_bonus.c */
 
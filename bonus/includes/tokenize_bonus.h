@@ -15,18 +15,34 @@
 
 //chars
 # define SPECIALCHARS "{}^!"
-# define INVALIDCHARS ";\\`~["
+# define INVALIDCHARS ";\\`~"
 # define PRTHESESCHARS "()"
 # define METACHARS "|<>&"
 # define ISSPACE " \t\n\v\f\r"
 # define SQUOTE 39
 # define DQUOTE 34
 
+//arithmetic
+# define ARITH_OPS "||;&&;|;^;&;== !=;<= >= < >;<< >>;+ -;* / %"
+# define ARITH_LEVELS 10
+# define ARITH_MAX_DEPTH 1024
+
 //messages
 # define UNEXPECTED_TOKEN "syntax error near unexpected token `%c'"
 # define UNEXPECTED_TOKEN_S "syntax error near unexpected token `%s'"
 # define OPEN_QUOTE "open quotes are not supported"
 # define OPEN_PRTHESES "open parentheses are not supported"
+# define OPEN_BRACE "open braces are not supported"
+# define BAD_SUBSTITUTION "${%s}: bad substitution"
+# define ARITH_ERROR "%s: %s (error token is \"%s\")"
+# define ARITH_ERROR_S "%s: %s"
+# define ARITH_SYNTAX "syntax error in expression"
+# define ARITH_OPERAND "syntax error: operand expected"
+# define ARITH_COLON "`:' expected for conditional expression"
+# define ARITH_PRTHESES "missing `)'"
+# define ARITH_DIV_ZERO "division by 0"
+# define ARITH_BASE "value too great for base"
+# define ARITH_RECURSION "expression recursion level exceeded"
 
 typedef enum e_type
 {
@@ -45,7 +61,8 @@ typedef enum e_type
 	SUB_ROOT,
 	REDIR,
 	NODE,
-	REDIR_OUT
+	REDIR_OUT,
+	BG
 }	t_type;
 
 typedef enum e_state
@@ -61,6 +78,7 @@ typedef struct s_token
 	t_state	state;
 	bool	expand;
 	bool	wildcard;
+	bool	brace;
 }	t_token;
 
 typedef struct s_node
@@ -83,11 +101,46 @@ typedef struct s_exec
 {
 	int		type;
 	t_list	**args;
+	t_list	**assigns;
+	bool	expanded;
 }	t_exec;
 
+typedef struct s_arith
+{
+	char	*expr;
+	int		pos;
+	int		skip;
+	int		depth;
+	bool	error;
+	t_shell	*sh;
+}	t_arith;
+
+typedef struct s_argv
+{
+	char	**v;
+	size_t	len;
+	size_t	cap;
+}	t_argv;
+
+typedef struct s_seq
+{
+	long	start;
+	long	end;
+	long	step;
+	int		width;
+	bool	alpha;
+}	t_seq;
+
+typedef struct s_brace
+{
+	t_argv	*argv;
+	bool	glob;
+}	t_brace;
+
 /* ft_find_next_quote_bonus.c */
 
 int		ft_find_next_quote(char *s, int i, char c);
+int		ft_find_next_brace(char *s, int i);
 
 /* ft_charjoin_bonus.c */
 
@@ -106,6 +159,8 @@ void	ft_error_syntax(char *message, char c);
 
 bool	ft_validate_logic_operator(char *s, int i);
 bool	ft_is_comment(char c, int *i);
+int		ft_skip_group(char *s, int i);
+bool	ft_is_background(char *s, int i);
 
 /* ft_ft_validate_parentheses_bonus.c */
 
@@ -134,23 +189,92 @@ void	*ft_process_input(char *input);
 
 /* ft_process_token_list_bonus.c */
 
-void	ft_process_token_list(t_list **token_list, char **envp);
+void	ft_process_token_list(t_list **token_list, t_shell *sh);
 void	ft_remove_current_node(t_list **list, t_list *prev, t_list *curr);
 
 /* ft_process_token_list_utils_bonus.c */
 
 void	ft_handle_dquotes(char **new_value, char *value, int *i, \
-		char **envp);
+		t_shell *sh);
 void	ft_handle_squotes(char **new_value, char *value, int *i);
 void	ft_handle_expansion(char **new_value, char *value, int *i, \
-		char **envp);
+		t_shell *sh);
 
 /* ft_process_token_list_utils2_bonus.c */
 
-void	ft_expand_tokens(t_token *token, char **envp);
+char	*ft_expand_str(char *value, t_shell *sh);
+void	ft_expand_tokens(t_token *token, t_shell *sh);
 void	ft_remove_quotes(t_token *tkn);
 bool	ft_is_expandable(char *s);
 
+/* ft_expand_braces_bonus.c */
+
+char	*ft_expand_braces(char *value, int *i, t_shell *sh);
+
+/* ft_expand_braces_utils_bonus.c */
+
+char	*ft_expand_word(char *word, t_shell *sh, bool unquote);
+void	ft_assign_param(char *name, char *word, t_shell *sh);
+char	*ft_param_operator(char *val, char *name, char *op, t_shell *sh);
+
+/* ft_expand_braces_utils2_bonus.c */
+
+char	*ft_param_substr(char *val, char *spec, t_shell *sh);
+char	*ft_param_trim(char *val, char *op, t_shell *sh);
+char	*ft_param_replace(char *val, char *spec, t_shell *sh);
+
+/* ft_expand_array_bonus.c */
+
+char	*ft_array_expand(char *body, int len, t_shell *sh);
+char	*ft_array_length(char *s, int len, t_shell *sh);
+
+/* ft_expand_fields_bonus.c */
+
+void	ft_array_fields(char *body, int len, char *value, t_shell *sh);
+void	ft_expand_fields(char **new_value, char *value, int *i, t_shell *sh);
+void	ft_insert_fields(t_list *node, t_shell *sh);
+
+/* ft_expand_arith_bonus.c */
+
+void	ft_arith_error(t_arith *ar, char *msg);
+void	ft_arith_skip_spaces(t_arith *ar);
+long	ft_arith_eval(char *expr, t_shell *sh, int depth, bool *error);
+char	*ft_expand_arith(char *value, int *i, t_shell *sh);
+
+/* ft_expand_arith_utils_bonus.c */
+
+long	ft_arith_assign(t_arith *ar);
+long	ft_arith_comma(t_arith *ar);
+
+/* ft_expand_arith_utils2_bonus.c */
+
+long	ft_arith_apply(t_arith *ar, char *op, long a, long b);
+long	ft_arith_binary(t_arith *ar, int level);
+
+/* ft_expand_arith_utils3_bonus.c */
+
+long	ft_arith_unary(t_arith *ar);
+
+/* ft_expand_arith_utils4_bonus.c */
+
+int		ft_arith_namelen(char *s);
+long	ft_arith_lookup(t_arith *ar, char *name, int len);
+long	ft_arith_store(t_arith *ar, char *name, int len, long value);
+long	ft_arith_incdec(t_arith *ar, int start, char c, bool prefix);
+long	ft_arith_variable(t_arith *ar);
+
+/* ft_brace_expansion_bonus.c */
+
+int		ft_brace_scan(char *s, int i, char stop);
+bool	ft_brace_find(char *s, int *grp);
+char	*ft_brace_join(char *word, int *grp, char *alt, int len);
+void	ft_brace_expand(char *word, t_brace *br);
+
+/* ft_brace_expansion_utils_bonus.c */
+
+bool	ft_seq_parse(char *s, int *grp, t_seq *seq);
+void	ft_brace_seq(char *word, int *grp, t_brace *br);
+
 /* ft_build_root_bonus.c */
 
 void	*ft_build_root(t_list **list, t_type node_type);
@@ -158,8 +282,6 @@ void	*ft_build_root(t_list **list, t_type node_type);
 /* ft_build_tree_bonus.c */
 
 void	*ft_build_tree(t_list **token_list, t_node **parent_node);
-void	ft_skip_export_tokens(t_list **list);
-bool	ft_validate_skip(t_list **list);
 
 /* ft_build_branch_bonus.c */
 
@@ -173,6 +295,7 @@ bool	ft_find_next_redir(t_list **list);
 /* ft_built_branch_utils2_bonus.c */
 
 t_node	*ft_create_subroot_node(t_list **list);
+t_list	**ft_split_assigns(t_exec *exec);
 t_redir	*ft_init_redir(t_token *token, t_list **list);
 
 /* ft_free_tree_bonus.c */
@@ -16,22 +16,16 @@
 /* ft_get_wildcard_list_bonus.c */
 
 t_list	**ft_get_wildcard_list(char *s);
-bool	ft_find_middle(char *s);
 
-/* ft_get_wildcard_list_utils_bonus.c */
+/* ft_match_pattern_bonus.c */
 
-bool	ft_find_sufix(char *s);
-bool	ft_match_prefix(char **s, char **entry_name);
-bool	ft_match_sufix(char **s, char **entry_name);
-
-/* ft_get_wildcard_list_utils2_bonus.c */
-
-int		ft_strncmp_(const char *str1, const char *str2, size_t len);
-char	*ft_strnstr_(char **big, const char *little, size_t len);
-bool	ft_match_middle(char **s, char **entry_name);
+bool	ft_match_pattern(char *pat, char *str);
+int		ft_match_head(char *pat, char *str, bool longest);
+int		ft_match_tail(char *pat, char *str, bool longest);
+char	*ft_replace_pattern(char *str, char *pat, char *rep, bool global);
 
 /* ft_set_alphabetical_order_bonus.c */
 
-t_list	**ft_set_alphabetical_order(t_list **old);
+t_list	**ft_set_alphabetical_order(t_list **list);
 
 #endif //WILDCARDS_BONUS_H
\ No newline at end of file
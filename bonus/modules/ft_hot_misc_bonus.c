@@ -0,0 +1,120 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_hot_misc_bonus.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: joneves- <joneves-@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by joneves-          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by joneves-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <unistd.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <errno.h>
+#include <time.h>
+#include <limits.h>
+#include "../includes/loadable_bonus.h"
+
+/**
+ * @brief Parses an integer argument of `seq`.
+ *
+ * @return 1 on success, 0 if `s` is not an integer.
+ */
+static int	ft_seq_arg(const char *s, long long *n)
+{
+	char	*end;
+
+	errno = 0;
+	*n = strtoll(s, &end, 10);
+	return (*s && !*end && !errno);
+}
+
+/**
+ * @brief `seq [FIRST [INCREMENT]] LAST`: prints a sequence of integers.
+ *
+ * Lines are gathered in a buffer and written in large blocks. The sequence
+ * stops before a step that would overflow a `long long`.
+ */
+static int	ft_seq(int argc, char **argv, t_shell *sh)
+{
+	long long	n[3];
+	char		buf[4096];
+	size_t		len;
+
+	(void)sh;
+	n[0] = 1;
+	n[1] = 1;
+	if (argc < 2 || argc > 4 || !ft_seq_arg(argv[argc - 1], &n[2])
+		|| (argc > 2 && !ft_seq_arg(argv[1], &n[0]))
+		|| (argc > 3 && !ft_seq_arg(argv[2], &n[1])) || n[1] == 0)
+		return (write(2, "seq: invalid argument\n", 22), 1);
+	len = 0;
+	while ((n[1] > 0 && n[0] <= n[2]) || (n[1] < 0 && n[0] >= n[2]))
+	{
+		len += snprintf(buf + len, sizeof(buf) - len, "%lld\n", n[0]);
+		if (len > sizeof(buf) - 32 && write(1, buf, len) == -1)
+			return (1);
+		if (len > sizeof(buf) - 32)
+			len = 0;
+		if ((n[1] > 0 && n[0] > LLONG_MAX - n[1])
+			|| (n[1] < 0 && n[0] < LLONG_MIN - n[1]))
+			break ;
+		n[0] += n[1];
+	}
+	return (len && write(1, buf, len) == -1);
+}
+
+/**
+ * @brief `sleep SECONDS`: pauses for a possibly fractional delay.
+ *
+ * A signal interrupts the pause, as it does for the external command. NaN
+ * and infinite delays are rejected.
+ */
+static int	ft_sleep(int argc, char **argv, t_shell *sh)
+{
+	struct timespec	ts;
+	char			*end;
+	double			secs;
+
+	(void)sh;
+	secs = -1;
+	if (argc == 2)
+		secs = strtod(argv[1], &end);
+	if (argc != 2 || !*argv[1] || *end || !(secs >= 0 && secs <= 1e9))
+		return (write(2, "sleep: invalid time interval\n", 29), 1);
+	ts.tv_sec = (time_t)secs;
+	ts.tv_nsec = (long)((secs - ts.tv_sec) * 1e9);
+	if (nanosleep(&ts, NULL) == -1)
+		return (130);
+	return (0);
+}
+
+/**
+ * @brief `true`: does nothing, successfully.
+ */
+static int	ft_true(int argc, char **argv, t_shell *sh)
+{
+	(void)argc;
+	(void)argv;
+	(void)sh;
+	return (0);
+}
+
+/**
+ * @brief `false`: does nothing, unsuccessfully.
+ */
+static int	ft_false(int argc, char **argv, t_shell *sh)
+{
+	(void)argc;
+	(void)argv;
+	(void)sh;
+	return (1);
+}
+
+const t_loadable	seq_loadable = {LOADABLE_ABI, "seq", ft_seq};
+const t_loadable	sleep_loadable = {LOADABLE_ABI, "sleep", ft_sleep};
+const t_loadable	true_loadable = {LOADABLE_ABI, "true", ft_true};
+const t_loadable	false_loadable = {LOADABLE_ABI, "false", ft_false};
@@ -0,0 +1,98 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_hot_path_bonus.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: joneves- <joneves-@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by joneves-          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by joneves-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <unistd.h>
+#include <string.h>
+#include "../includes/loadable_bonus.h"
+
+/**
+ * @brief Writes `len` bytes of `s` followed by a newline.
+ *
+ * @return 0 on success, 1 if the output failed.
+ */
+static int	ft_hot_putline(const char *s, size_t len)
+{
+	if (write(STDOUT_FILENO, s, len) == -1
+		|| write(STDOUT_FILENO, "\n", 1) == -1)
+		return (1);
+	return (0);
+}
+
+/**
+ * @brief Strips trailing slashes from `s`, keeping a lone `/`.
+ *
+ * @return The remaining length.
+ */
+static size_t	ft_hot_trim(const char *s)
+{
+	size_t	len;
+
+	len = strlen(s);
+	while (len > 1 && s[len - 1] == '/')
+		len--;
+	return (len);
+}
+
+/**
+ * @brief `basename NAME [SUFFIX]`: prints NAME without its leading
+ *        directories, and without SUFFIX if it ends with it.
+ */
+static int	ft_basename(int argc, char **argv, t_shell *sh)
+{
+	const char	*name;
+	size_t		len;
+	size_t		start;
+	size_t		slen;
+
+	(void)sh;
+	if (argc < 2 || argc > 3)
+		return (write(2, "basename: usage: basename NAME [SUFFIX]\n", 40), 2);
+	name = argv[1];
+	len = ft_hot_trim(name);
+	start = len;
+	while (start > 0 && name[start - 1] != '/')
+		start--;
+	if (len == 1 && name[0] == '/')
+		start = 0;
+	slen = 0;
+	if (argc == 3)
+		slen = strlen(argv[2]);
+	if (slen && slen < len - start
+		&& !strncmp(name + len - slen, argv[2], slen))
+		len -= slen;
+	return (ft_hot_putline(name + start, len - start));
+}
+
+/**
+ * @brief `dirname NAME`: prints NAME without its last component.
+ */
+static int	ft_dirname(int argc, char **argv, t_shell *sh)
+{
+	const char	*name;
+	size_t		len;
+
+	(void)sh;
+	if (argc != 2)
+		return (write(2, "dirname: usage: dirname NAME\n", 29), 2);
+	name = argv[1];
+	len = ft_hot_trim(name);
+	while (len > 0 && name[len - 1] != '/')
+		len--;
+	if (len == 0)
+		return (ft_hot_putline(".", 1));
+	while (len > 1 && name[len - 1] == '/')
+		len--;
+	return (ft_hot_putline(name, len));
+}
+
+const t_loadable	basename_loadable = {LOADABLE_ABI, "basename", ft_basename};
+const t_loadable	dirname_loadable = {LOADABLE_ABI, "dirname", ft_dirname};
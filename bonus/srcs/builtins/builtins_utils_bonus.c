@@ -38,38 +38,28 @@ int	ft_argslen(char **args)
 /**
  * @brief Checks if the given command is a built-in command.
  *
- * This function compares the provided command (args[0]) against a predefined
- * list of built-in commands (e.g., cd, pwd, export, unset, exit, echo, env).
- * Returns TRUE if the command matches a built-in, otherwise FALSE.
+ * This function looks the provided command (args[0]) up, as a whole word,
+ * in the `BUILTINS` list (e.g., cd, pwd, export, unset, exit, echo, env),
+ * then among the builtins loaded with `enable -f`. Returns TRUE if the
+ * command matches a built-in, otherwise FALSE.
  *
  * @param args The array of arguments, where args[0] is the command name.
+ * @param sh The shell structure holding the loaded builtins.
  * @return TRUE if args[0] is a built-in command, FALSE otherwise.
  */
-bool	ft_isbuiltin(char **args)
+bool	ft_isbuiltin(char **args, t_shell *sh)
 {
-	const char	*bcmd[8];
-	int			i;
+	char	*needle;
+	bool	found;
 
-	i = 0;
-	bcmd[0] = "cd";
-	bcmd[1] = "pwd";
-	bcmd[2] = "export";
-	bcmd[3] = "unset";
-	bcmd[4] = "exit";
-	bcmd[5] = "echo";
-	bcmd[6] = "env";
-	bcmd[7] = NULL;
-	if (*args)
-	{
-		while (bcmd[i])
-		{
-			if (ft_strncmp(bcmd[i], args[0], ft_strlen(args[0])) == 0
-				&& *args[0])
-				return (TRUE);
-			i++;
-		}
-	}
-	return (FALSE);
+	if (!*args || !**args || ft_strchr(*args, ':'))
+		return (FALSE);
+	needle = merge(ft_strjoin(":", *args), ":");
+	if (!needle)
+		return (ft_error_malloc("needle"), FALSE);
+	found = (ft_strnstr(BUILTINS, needle, ft_strlen(BUILTINS)) != NULL);
+	free(needle);
+	return (found || ft_loadable_find(*args, sh));
 }
 
 /**
@@ -89,49 +79,74 @@ void	ft_exec_builtin(char **args, t_shell *sh)
 	argc = ft_argslen(args);
 	if (sh->error_fd == 0)
 	{
-		if (ft_strncmp("cd", args[0], ft_strlen(args[0])) == 0)
+		if (ft_strcmp("cd", args[0]) == 0)
 			ft_cd(argc, args[1], sh->global);
-		else if (ft_strncmp("pwd", args[0], ft_strlen(args[0])) == 0)
+		else if (ft_strcmp("pwd", args[0]) == 0)
 			ft_pwd();
-		else if (ft_strncmp("export", args[0], ft_strlen(args[0])) == 0)
+		else if (ft_strcmp("export", args[0]) == 0)
 			ft_export(argc, args, sh, GLOBAL);
-		else if (ft_strncmp("unset", args[0], ft_strlen(args[0])) == 0)
+		else if (ft_strcmp("unset", args[0]) == 0)
 			ft_unset(argc, args, sh);
-		else if (ft_strncmp("exit", args[0], ft_strlen(args[0])) == 0)
+		else if (ft_strcmp("exit", args[0]) == 0)
 			ft_exit(argc, args, sh);
-		else if (ft_strncmp("echo", args[0], ft_strlen(args[0])) == 0)
+		else if (ft_strcmp("echo", args[0]) == 0)
 			ft_echo(args);
-		else if (ft_strncmp("env", args[0], ft_strlen(args[0])) == 0)
+		else if (ft_strcmp("env", args[0]) == 0)
 			ft_env(argc, args, sh->global);
+		else
+			ft_exec_builtin_ext(argc, args, sh);
 	}
 }
 
 /**
- * @brief Frees memory allocated for a token list and an argument vector.
- *
- * This function releases memory associated with a token list (`args_cp`) 
- * and a corresponding array of strings (`new_args`).
+ * @brief Executes the built-in commands added on top of the basic ones
+ *        (`declare`, `mapfile`/`readarray`, `hash`, `enable`, `set`, the job
+ *        control builtins `wait`, `jobs` and `kill`, `parallel`, and the
+ *        builtins loaded by `enable -f`).
  *
- * @param args_cp A double pointer to the token list to be freed.
- * @param new_args A double pointer to the array of strings to be freed.
+ * @param argc The number of arguments.
+ * @param args The array of arguments, where args[0] is the command name.
+ * @param sh The shell structure containing the variables and arrays.
  */
-static void	ft_free_helper(t_list **args_cp, char **new_args)
+void	ft_exec_builtin_ext(int argc, char **args, t_shell *sh)
 {
-	if (*args_cp)
-		ft_free_list(*args_cp);
-	if (args_cp)
-		free(args_cp);
-	if (new_args)
-		ft_free_vector(new_args);
+	if (ft_strcmp("declare", args[0]) == 0)
+		ft_declare(argc, args, sh);
+	else if (ft_strcmp("mapfile", args[0]) == 0
+		|| ft_strcmp("readarray", args[0]) == 0)
+		ft_mapfile(argc, args, sh);
+	else if (ft_strcmp("hash", args[0]) == 0)
+		ft_hash(argc, args, sh);
+	else if (ft_strcmp("enable", args[0]) == 0)
+		ft_enable(argc, args, sh);
+	else if (ft_strcmp("set", args[0]) == 0)
+		ft_set(argc, args, sh);
+	else if (ft_strcmp("wait", args[0]) == 0)
+		ft_wait(argc, args, sh);
+	else if (ft_strcmp("jobs", args[0]) == 0)
+		ft_jobs(argc, args, sh);
+	else if (ft_strcmp("kill", args[0]) == 0)
+		ft_kill(argc, args, sh);
+	else if (ft_strcmp("parallel", args[0]) == 0)
+		ft_parallel(argc, args, sh);
+	else if (ft_strcmp("xargs", args[0]) == 0)
+		ft_xargs(argc, args, sh);
+	else
+		ft_loadable_run(argc, args, sh);
 }
 
 /**
  * @brief Checks if the node contains only a built-in command.
  *
  * This function evaluates a syntax tree node to determine if it represents
- * a built-in command without external commands or pipes. If the node is an
- * executable type and its arguments match a built-in command, the function
- * returns true.
+ * a single command without pipes. The arguments of that command are
+ * processed in place, exactly once, and the executable node is flagged as
+ * expanded so the launcher does not process them again. Expansions with side
+ * effects (such as `${var:=word}`) are therefore evaluated a single time.
+ * If the arguments match a built-in command, the function returns true,
+ * except for `env VAR=x cmd`, whose command must run in a child process.
+ * It also returns true when an argument failed to expand (see
+ * `expand_fail`), so that the command is skipped in the shell.
  *
  * @param node The current syntax tree node to check.
  * @param sh The shell structure with environment and execution context.
@@ -143,24 +158,26 @@ static void	ft_free_helper(t_list **args_cp, char **new_args)
 int	ft_isjustbuiltin(void *node, t_shell *sh)
 {
 	t_node	*curr;
-	t_list	**args_cp;
 	char	**new_args;
+	int		result;
 
 	curr = ((t_node *)node)->left;
-	if (!((t_node *)node)->right)
-	{
-		while (curr && ft_is_node_type(curr, REDIR))
-			curr = ((t_redir *)curr)->next;
-		if (curr && ft_is_node_type(curr, EXEC))
-		{
-			args_cp = ft_copy_list(((t_exec *)curr)->args);
-			ft_process_token_list(args_cp, ft_merge_env(sh->global, sh->local));
-			new_args = tokentostring(args_cp);
-			if (ft_isbuiltin(new_args) || ((t_exec *)curr)->type == EXPORT
-				|| ((t_exec *)curr)->type == EXPORT_AP)
-				return (ft_free_helper(args_cp, new_args), TRUE);
-			ft_free_helper(args_cp, new_args);
-		}
-	}
-	return (FALSE);
+	if (((t_node *)node)->right)
+		return (FALSE);
+	while (curr && ft_is_node_type(curr, REDIR))
+		curr = ((t_redir *)curr)->next;
+	if (!curr || !ft_is_node_type(curr, EXEC))
+		return (FALSE);
+	sh->expand_fail = false;
+	sh->subst = false;
+	ft_process_token_list(((t_exec *)curr)->args, sh);
+	((t_exec *)curr)->expanded = true;
+	if (sh->expand_fail)
+		return (TRUE);
+	new_args = tokentostring(((t_exec *)curr)->args);
+	result = ((ft_isbuiltin(new_args, sh) && !ft_env_command(new_args))
+			|| ((t_exec *)curr)->type == EXPORT
+			|| ((t_exec *)curr)->type == EXPORT_AP);
+	ft_free_vector(new_args);
+	return (result);
 }
@@ -0,0 +1,119 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_array_assign_bonus.c                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: joneves- <joneves-@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by joneves-          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by joneves-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell_bonus.h"
+
+/**
+ * @brief Splits the body of a `name=(...)` list into expanded words.
+ *
+ * The words are tokenized and expanded like the arguments of a command,
+ * so quoting, parameter expansion, brace expansion and globbing all apply.
+ *
+ * @param arg The assignment word.
+ * @param start The index of the first character after the `(`.
+ * @param sh A pointer to the shell structure used for expansions.
+ * @return A NULL-terminated vector of words, or NULL on error.
+ */
+static char	**ft_array_words(char *arg, int start, t_shell *sh)
+{
+	t_list	**list;
+	char	**words;
+	char	*body;
+
+	body = ft_substr(arg, start, ft_strlen(arg) - start - 1);
+	if (!body)
+		return (ft_error_malloc("body"), NULL);
+	list = ft_create_token_list(body);
+	free(body);
+	if (!list)
+		return (NULL);
+	ft_process_token_list(list, sh);
+	words = ft_tokens_argv(list, true);
+	ft_free_list(*list);
+	free(list);
+	return (words);
+}
+
+/**
+ * @brief Stores the words of a list assignment into an array.
+ *
+ * A `[key]=value` word sets that element; any other word is appended after
+ * the last element, which associative arrays do not allow.
+ *
+ * @param arr The array being assigned.
+ * @param words The expanded words of the list.
+ * @param sh A pointer to the shell structure, used to evaluate indexes.
+ */
+static void	ft_array_fill(t_array *arr, char **words, t_shell *sh)
+{
+	char	*eq;
+	int		i;
+
+	i = -1;
+	while (words[++i])
+	{
+		eq = NULL;
+		if (words[i][0] == '[')
+			eq = ft_strnstr(words[i], "]=", ft_strlen(words[i]));
+		if (eq)
+		{
+			*eq = '\0';
+			ft_array_set(arr, words[i] + 1, eq + 2, sh);
+		}
+		else if (arr->assoc)
+		{
+			ft_stderror(FALSE, ASSOC_SUBSCRIPT, arr->name, words[i]);
+			ft_exit_status(1, TRUE, FALSE);
+		}
+		else
+			ft_array_push(arr, ft_strdup(words[i]));
+	}
+}
+
+/**
+ * @brief Performs an assignment word that targets an array.
+ *
+ * Handles `name[sub]=value`, `name=(...)` and their `+=` variants, creating
+ * an indexed array when the name is new. A plain `name=value` is only
+ * handled here when an array of that name already exists.
+ *
+ * @param arg The assignment word.
+ * @param sh A pointer to the shell structure holding the arrays.
+ * @return true if the word was an array assignment, false otherwise.
+ */
+bool	ft_array_assign(char *arg, t_shell *sh)
+{
+	t_array	*arr;
+	char	**words;
+	int		form;
+	int		len;
+
+	form = ft_array_form(arg);
+	len = ft_arith_namelen(arg);
+	if (!form)
+		return (ft_array_scalar(arg, len, sh));
+	arr = ft_array_new(arg, len, false, sh);
+	if (!arr)
+		return (true);
+	if (form == ARRAY_ELEM)
+		return (ft_array_elem(arr, arg + len, sh), true);
+	if (arg[len] == '+')
+		len++;
+	words = ft_array_words(arg, len + 2, sh);
+	if (!words)
+		return (true);
+	if (arg[len - 1] != '+')
+		ft_array_clear(arr);
+	ft_array_fill(arr, words, sh);
+	ft_free_vector(words);
+	return (true);
+}
@@ -0,0 +1,113 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_array_assign_utils_bonus.c                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: joneves- <joneves-@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by joneves-          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by joneves-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell_bonus.h"
+
+/**
+ * @brief Tells which array assignment form a word has, if any.
+ *
+ * `name[sub]=value` and `name[sub]+=value` assign one element, while
+ * `name=(...)` and `name+=(...)` assign a whole list.
+ *
+ * @param s The assignment word.
+ * @return ARRAY_ELEM, ARRAY_LIST or 0 if the word is not an array form.
+ */
+int	ft_array_form(char *s)
+{
+	char	*close;
+	int		i;
+
+	i = ft_arith_namelen(s);
+	if (!i)
+		return (0);
+	if (s[i] == '[')
+	{
+		close = ft_strchr(s + i, ']');
+		if (!close || close == s + i + 1)
+			return (0);
+		if (close[1] == '=' || (close[1] == '+' && close[2] == '='))
+			return (ARRAY_ELEM);
+		return (0);
+	}
+	if (s[i] == '+')
+		i++;
+	if (s[i] == '=' && s[i + 1] == '(' && s[ft_strlen(s) - 1] == ')')
+		return (ARRAY_LIST);
+	return (0);
+}
+
+/**
+ * @brief Assigns one element from a `[sub]=value` or `[sub]+=value` word.
+ *
+ * @param arr The array being assigned.
+ * @param rest The part of the word starting at the `[`.
+ * @param sh A pointer to the shell structure, used to evaluate indexes.
+ */
+void	ft_array_elem(t_array *arr, char *rest, t_shell *sh)
+{
+	char	*close;
+	char	*key;
+	char	*value;
+	char	*old;
+
+	close = ft_strchr(rest, ']');
+	key = ft_substr(rest, 1, close - rest - 1);
+	if (close[1] == '+')
+	{
+		old = ft_array_get(arr, key, sh);
+		if (!old)
+			old = "";
+		value = ft_strjoin(old, close + 3);
+	}
+	else
+		value = ft_strdup(close + 2);
+	if (key && value)
+		ft_array_set(arr, key, value, sh);
+	else
+		ft_error_malloc("array");
+	free(key);
+	free(value);
+}
+
+/**
+ * @brief Assigns a plain `name=value` word to an existing array.
+ *
+ * As in bash, a scalar assignment to an array name sets its first element
+ * (index 0), and `+=` appends to it.
+ *
+ * @param arg The assignment word.
+ * @param len The length of the name.
+ * @param sh A pointer to the shell structure holding the arrays.
+ * @return true if an array of that name exists and was assigned.
+ */
+bool	ft_array_scalar(char *arg, int len, t_shell *sh)
+{
+	t_array	*arr;
+	char	*value;
+	char	*old;
+
+	if (!len || (arg[len] != '=' && ft_strncmp(arg + len, "+=", 2)))
+		return (false);
+	arr = ft_array_find(arg, len, sh);
+	if (!arr)
+		return (false);
+	old = ft_array_first(arr);
+	if (arg[len] == '+' && old)
+		value = ft_strjoin(old, arg + len + 2);
+	else
+		value = ft_strdup(ft_strchr(arg, '=') + 1);
+	if (!value)
+		return (ft_error_malloc("array"), true);
+	ft_array_set(arr, "0", value, sh);
+	free(value);
+	return (true);
+}
@@ -0,0 +1,175 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_declare_bonus.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: joneves- <joneves-@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by joneves-          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by joneves-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell_bonus.h"
+
+/**
+ * @brief Reads the option arguments of `declare`.
+ *
+ * Only the array attributes are supported: `-a` (indexed) and `-A`
+ * (associative). Other option letters are accepted and ignored.
+ *
+ * @param argc The number of arguments.
+ * @param argv The arguments, starting with `declare`.
+ * @param array Set to true if an array attribute was given.
+ * @param assoc Set to true if `-A` was given.
+ * @return The index of the first non-option argument.
+ */
+static int	ft_declare_flags(int argc, char **argv, bool *array, bool *assoc)
+{
+	int	i;
+
+	i = 1;
+	*array = false;
+	*assoc = false;
+	while (i < argc && argv[i][0] == '-' && argv[i][1])
+	{
+		if (ft_strchr(argv[i], 'a') || ft_strchr(argv[i], 'A'))
+			*array = true;
+		if (ft_strchr(argv[i], 'A'))
+			*assoc = true;
+		i++;
+	}
+	return (i);
+}
+
+/**
+ * @brief Declares one name, with an optional assignment.
+ *
+ * @param arg The argument (`name`, `name=value`, `name=(...)`, ...).
+ * @param array Whether the name is declared as an array.
+ * @param assoc Whether a new array is associative.
+ * @param sh A pointer to the shell structure holding the variables.
+ */
+static void	ft_declare_arg(char *arg, bool array, bool assoc, t_shell *sh)
+{
+	int	len;
+
+	len = ft_arith_namelen(arg);
+	if (!ft_array_form(arg) && (!len || (arg[len] && arg[len] != '='
+				&& ft_strncmp(arg + len, "+=", 2))))
+	{
+		ft_stderror(FALSE, DECLARE_IDENTIFIER, arg);
+		ft_exit_status(1, TRUE, FALSE);
+	}
+	else if (array || ft_array_form(arg))
+	{
+		if (ft_array_new(arg, len, assoc, sh) && ft_strchr(arg, '='))
+			ft_array_assign(arg, sh);
+	}
+	else if (ft_strchr(arg, '='))
+		ft_assign_local(arg, sh);
+}
+
+/**
+ * @brief Executes the `declare` builtin.
+ *
+ * Creates indexed (`-a`) or associative (`-A`) arrays and performs the
+ * given assignments as shell variables.
+ *
+ * @param argc The number of arguments.
+ * @param argv The arguments, starting with `declare`.
+ * @param sh A pointer to the shell structure holding the variables.
+ * @return The exit status.
+ */
+int	ft_declare(int argc, char **argv, t_shell *sh)
+{
+	bool	array;
+	bool	assoc;
+	int		i;
+
+	i = ft_declare_flags(argc, argv, &array, &assoc);
+	ft_exit_status(0, TRUE, FALSE);
+	while (i < argc)
+		ft_declare_arg(argv[i++], array, assoc, sh);
+	return (ft_exit_status(0, FALSE, FALSE));
+}
+
+/**
+ * @brief Splits a buffer into lines and appends them to an array.
+ *
+ * Each line is copied straight out of the buffer, so the whole input is
+ * split in a single pass.
+ *
+ * @param arr The array receiving the lines.
+ * @param data The buffer read from the input.
+ * @param len The number of bytes in the buffer.
+ * @param trim Whether the trailing newline of each line is removed.
+ */
+static void	ft_mapfile_lines(t_array *arr, char *data, size_t len, bool trim)
+{
+	size_t	start;
+	size_t	end;
+	char	*line;
+
+	start = 0;
+	while (start < len)
+	{
+		end = start;
+		while (end < len && data[end] != '\n')
+			end++;
+		if (!trim && end < len)
+			end++;
+		line = (char *)malloc(end - start + 1);
+		if (line)
+		{
+			ft_memcpy(line, data + start, end - start);
+			line[end - start] = '\0';
+		}
+		if (ft_array_push(arr, line) == -1)
+			return ;
+		if (trim)
+			end++;
+		start = end;
+	}
+}
+
+/**
+ * @brief Executes the `mapfile` (or `readarray`) builtin.
+ *
+ * Reads the whole standard input in one buffered pass and stores one line
+ * per element of an indexed array (MAPFILE unless a name is given). `-t`
+ * strips the trailing newline of each line.
+ *
+ * @param argc The number of arguments.
+ * @param argv The arguments, starting with `mapfile`.
+ * @param sh A pointer to the shell structure holding the arrays.
+ * @return The exit status.
+ */
+int	ft_mapfile(int argc, char **argv, t_shell *sh)
+{
+	t_array	*arr;
+	char	*data;
+	size_t	len;
+	int		i;
+
+	i = 1;
+	if (i < argc && !ft_strcmp(argv[i], "-t"))
+		i++;
+	if (i < argc && (!ft_arith_namelen(argv[i])
+			|| argv[i][ft_arith_namelen(argv[i])]))
+		return (ft_stderror(FALSE, MAPFILE_IDENTIFIER, argv[i]),
+			ft_exit_status(1, TRUE, FALSE));
+	if (i < argc)
+		arr = ft_array_new(argv[i], ft_strlen(argv[i]), false, sh);
+	else
+		arr = ft_array_new("MAPFILE", 7, false, sh);
+	data = ft_read_all(STDIN_FILENO, &len);
+	if (!data)
+		ft_error_malloc("data");
+	if (!arr || !data)
+		return (free(data), ft_exit_status(1, TRUE, FALSE));
+	ft_array_clear(arr);
+	ft_mapfile_lines(arr, data, len, i > 1 && !ft_strcmp(argv[1], "-t"));
+	free(data);
+	return (ft_exit_status(0, TRUE, FALSE));
+}
@@ -0,0 +1,140 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_enable_bonus.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: joneves- <joneves-@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by joneves-          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by joneves-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell_bonus.h"
+
+/**
+ * @brief Lists the builtins, as `enable` does without arguments.
+ *
+ * @param sh A pointer to the shell structure holding the loaded builtins.
+ */
+static void	ft_enable_print(t_shell *sh)
+{
+	char	**names;
+	t_list	*curr;
+	int		i;
+
+	names = ft_split(BUILTINS, ':');
+	if (!names)
+		return (ft_error_malloc("names"));
+	i = 0;
+	while (names[i])
+		printf("enable %s\n", names[i++]);
+	ft_free_vector(names);
+	curr = sh->loaded;
+	while (curr)
+	{
+		printf("enable %s\n", ((t_enabled *)curr->content)->ld->name);
+		curr = curr->next;
+	}
+}
+
+/**
+ * @brief Looks up the descriptor of builtin `name` in a module.
+ *
+ * @param handle The module handle.
+ * @param name The builtin name.
+ * @return The descriptor, or NULL if the module does not provide a builtin
+ *         with that name for this version of the interface.
+ */
+static t_loadable	*ft_enable_symbol(void *handle, char *name)
+{
+	t_loadable	*ld;
+	char		*symbol;
+
+	symbol = ft_strjoin(name, "_loadable");
+	if (!symbol)
+		return (ft_error_malloc("symbol"), NULL);
+	ld = (t_loadable *)dlsym(handle, symbol);
+	free(symbol);
+	if (!ld || ld->abi != LOADABLE_ABI || !ld->func || !ld->name
+		|| ft_strcmp((char *)ld->name, name))
+		return (NULL);
+	return (ld);
+}
+
+/**
+ * @brief Loads builtin `name` from the shared object `lib`.
+ *
+ * Builtins of the shell itself and already loaded names cannot be replaced.
+ * Each loaded builtin holds its own reference to the module, which is only
+ * unloaded when the last of its builtins is.
+ *
+ * @param lib The path of the shared object.
+ * @param name The builtin name.
+ * @param sh A pointer to the shell structure holding the loaded builtins.
+ * @return true on success, false (after printing an error) otherwise.
+ */
+static bool	ft_enable_load(char *lib, char *name, t_shell *sh)
+{
+	t_enabled	*entry;
+	t_list		*node;
+	void		*handle;
+	t_loadable	*ld;
+
+	if (ft_isbuiltin(&name, sh))
+		return (ft_stderror(FALSE, "enable: %s: already a builtin", name), \
+			false);
+	handle = dlopen(lib, RTLD_NOW | RTLD_LOCAL);
+	if (!handle)
+		return (ft_stderror(FALSE, "enable: %s", dlerror()), false);
+	ld = ft_enable_symbol(handle, name);
+	if (!ld)
+		return (ft_stderror(FALSE, "enable: %s: not a loadable builtin in %s", \
+			name, lib), dlclose(handle), false);
+	entry = (t_enabled *)malloc(sizeof(t_enabled));
+	node = ft_lstnew(entry);
+	if (!entry || !node)
+		return (free(entry), free(node), dlclose(handle), \
+			ft_error_malloc("enable"), false);
+	entry->ld = ld;
+	entry->handle = handle;
+	ft_lstadd_back(&sh->loaded, node);
+	return (true);
+}
+
+/**
+ * @brief Adds or removes builtins at run time.
+ *
+ * `enable -f lib.so name...` loads builtins from a shared object (see
+ * `loadable_bonus.h`), `enable -d name...` unloads them, and `enable` alone
+ * lists every builtin. Loaded builtins run inside the shell like the others,
+ * so calling them costs no `fork` or `execve`.
+ *
+ * @param argc The number of arguments.
+ * @param argv The arguments.
+ * @param sh A pointer to the shell structure holding the loaded builtins.
+ * @return The exit status: 0, 1 if a name failed, or 2 on a usage error.
+ */
+int	ft_enable(int argc, char **argv, t_shell *sh)
+{
+	int	status;
+	int	i;
+
+	if (argc == 1)
+		return (ft_enable_print(sh), ft_exit_status(0, TRUE, FALSE));
+	if ((ft_strcmp(argv[1], "-f") || argc < 4)
+		&& (ft_strcmp(argv[1], "-d") || argc < 3))
+		return (ft_stderror(FALSE, ENABLE_USAGE), \
+			ft_exit_status(2, TRUE, FALSE));
+	status = 0;
+	i = 2 + (argv[1][1] == 'f');
+	while (i < argc)
+	{
+		if (argv[1][1] == 'f' && !ft_enable_load(argv[2], argv[i], sh))
+			status = 1;
+		if (argv[1][1] == 'd' && !ft_enable_delete(argv[i], sh))
+			status = 1;
+		i++;
+	}
+	return (ft_exit_status(status, TRUE, FALSE));
+}
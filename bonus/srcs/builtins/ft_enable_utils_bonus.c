@@ -0,0 +1,90 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_enable_utils_bonus.c                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: joneves- <joneves-@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by joneves-          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by joneves-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell_bonus.h"
+
+/**
+ * @brief Finds a builtin loaded with `enable -f`.
+ *
+ * @param name The builtin name.
+ * @param sh A pointer to the shell structure holding the loaded builtins.
+ * @return The builtin's descriptor, or NULL if no such builtin is loaded.
+ */
+t_loadable	*ft_loadable_find(char *name, t_shell *sh)
+{
+	t_list	*curr;
+
+	curr = sh->loaded;
+	while (curr)
+	{
+		if (!ft_strcmp((char *)((t_enabled *)curr->content)->ld->name, name))
+			return (((t_enabled *)curr->content)->ld);
+		curr = curr->next;
+	}
+	return (NULL);
+}
+
+/**
+ * @brief Runs a loaded builtin and records its exit status.
+ *
+ * @param argc The number of arguments.
+ * @param args The arguments, the builtin name first.
+ * @param sh A pointer to the shell structure.
+ * @return true if `args[0]` is a loaded builtin, false otherwise.
+ */
+bool	ft_loadable_run(int argc, char **args, t_shell *sh)
+{
+	t_loadable	*ld;
+
+	ld = ft_loadable_find(args[0], sh);
+	if (!ld)
+		return (false);
+	ft_exit_status(ld->func(argc, args, sh), TRUE, FALSE);
+	return (true);
+}
+
+/**
+ * @brief Frees a loaded builtin, dropping its reference to the module.
+ *
+ * @param content The `t_enabled` entry.
+ */
+void	ft_enabled_free(void *content)
+{
+	dlclose(((t_enabled *)content)->handle);
+	free(content);
+}
+
+/**
+ * @brief Unloads a builtin, as `enable -d name` does.
+ *
+ * @param name The builtin name.
+ * @param sh A pointer to the shell structure holding the loaded builtins.
+ * @return true on success, false if `name` was not loaded.
+ */
+bool	ft_enable_delete(char *name, t_shell *sh)
+{
+	t_loadable	*ld;
+	t_list		**curr;
+	t_list		*node;
+
+	ld = ft_loadable_find(name, sh);
+	if (!ld)
+		return (ft_stderror(FALSE, "enable: %s: not dynamically loaded", \
+			name), false);
+	curr = &sh->loaded;
+	while (((t_enabled *)(*curr)->content)->ld != ld)
+		curr = &(*curr)->next;
+	node = *curr;
+	*curr = node->next;
+	ft_lstdelone(node, ft_enabled_free);
+	return (true);
+}
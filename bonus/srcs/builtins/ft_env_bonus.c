@@ -18,32 +18,40 @@
  * This function iterates through the `envp` array and prints each
  * environment variable (each string) to the standard output. If the `envp` or 
  * `*envp` array is `NULL`, it calls the error handler to handle the situation
- * appropriately.
+ * appropriately. `VAR=value` arguments are printed in place of (or after) the
+ * variables they override, without changing the environment. Running a
+ * command (`env VAR=value cmd`) is handled by `ft_exec`.
  *
+ * @param argc The number of arguments.
+ * @param args The arguments, starting with `env`.
  * @param envp The array of environment variables to print.
  */
 void	ft_env(int argc, char **args, char **envp)
 {
-	int	i;
+	char	**overlay;
+	int		i;
 
-	i = 0;
-	if (!envp || !*envp)
+	i = 1;
+	while (i < argc && ft_strchr(args[i], '=') && args[i][0] != '=')
+		i++;
+	if (i < argc)
 	{
-		ft_stderror(FALSE, "env: No such file or directory");
+		ft_stderror(FALSE, "env: `%s`: No such file or directory", args[i]);
 		ft_exit_status(127, TRUE, FALSE);
 		return ;
 	}
-	if (argc > 1)
+	overlay = ft_overlay_env(envp, args + 1);
+	if (!overlay || !*overlay)
 	{
-		ft_stderror(FALSE, "env: `%s`: No such file or directory", args[1]);
+		free(overlay);
+		ft_stderror(FALSE, "env: No such file or directory");
 		ft_exit_status(127, TRUE, FALSE);
 		return ;
 	}
-	while (envp[i])
-	{
-		printf("%s\n", envp[i]);
-		i++;
-	}
+	i = 0;
+	while (overlay[i])
+		printf("%s\n", overlay[i++]);
+	free(overlay);
 	ft_exit_status(0, TRUE, FALSE);
 }
 
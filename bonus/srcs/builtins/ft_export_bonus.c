@@ -140,9 +140,9 @@ int	concatenate_var(char *str, char ***envp, t_env mode, t_shell *sh)
  * @brief Exports local shell variables.
  *
  * Processes and exports local shell variables. It checks if the keys are valid
- * and contain '='.If the variable contains '+', it concatenates; otherwise, it
- * replaces the variable. It updates either the global or local shell variables
- * based on the provided arguments.
+ * and contain '='. Array assignments (`name[sub]=value`, `name=(...)`) are
+ * stored as arrays; any other assignment is handed to `ft_assign_local`.
+ * The status is 1 if any assignment failed (e.g. a bad array subscript).
  *
  * @param argv An array of strings representing the arguments.
  * @param sh The shell structure containing the global and local environments.
@@ -151,30 +151,21 @@ int	concatenate_var(char *str, char ***envp, t_env mode, t_shell *sh)
  */
 static int	ft_export_local(char **argv, t_shell *sh)
 {
-	size_t	s_key;
+	int	failed;
 
 	if (ft_check_keys_argv(argv) != 0)
 		return (ft_exit_status(1, TRUE, FALSE));
-	while (*argv)
+	failed = 0;
+	while (*argv && ft_strchr(*argv, '='))
 	{
-		if (!ft_strchr(*argv, '='))
-			return (ft_exit_status(0, TRUE, FALSE));
-		s_key = (ft_strlen(*argv) - ft_strlen(ft_strchr(*argv, '=')));
-		if ((*argv)[s_key - 1] == '+')
-		{
-			if (concatenate_var(*argv, &(sh->global), LOCAL, NULL) == -1
-				&& ft_limbo_import(sh, *argv) == -1)
-				concatenate_var(*argv, &(sh->local), DEFAULT, sh);
-		}
-		else
-		{
-			if (replace_var(*argv, &(sh->global), LOCAL, sh) == -1
-				&& ft_limbo_import(sh, *argv) == -1)
-				replace_var(*argv, &(sh->local), DEFAULT, sh);
-		}
+		ft_exit_status(0, TRUE, FALSE);
+		if (!ft_array_assign(*argv, sh))
+			ft_assign_local(*argv, sh);
+		if (ft_exit_status(0, FALSE, FALSE) != 0)
+			failed = 1;
 		argv++;
 	}
-	return (ft_exit_status(0, TRUE, FALSE));
+	return (ft_exit_status(failed, TRUE, FALSE));
 }
 
 /**
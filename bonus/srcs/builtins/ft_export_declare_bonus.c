@@ -109,3 +109,29 @@ void	ft_print_export(char **envp)
 	free(sorted_envp);
 	ft_free_vector(envp);
 }
+
+/**
+ * @brief Assigns a shell variable from a `name=value` or `name+=value` word.
+ *
+ * If the variable is already exported, it is updated in the global
+ * environment; otherwise it is stored as a local variable. A `+=` appends
+ * to the current value, and any other assignment replaces it.
+ *
+ * @param arg The assignment word.
+ * @param sh The shell structure containing the global and local environments.
+ */
+void	ft_assign_local(char *arg, t_shell *sh)
+{
+	size_t	s_key;
+
+	s_key = (ft_strlen(arg) - ft_strlen(ft_strchr(arg, '=')));
+	if (s_key > 0 && arg[s_key - 1] == '+')
+	{
+		if (concatenate_var(arg, &(sh->global), LOCAL, NULL) == -1
+			&& ft_limbo_import(sh, arg) == -1)
+			concatenate_var(arg, &(sh->local), DEFAULT, sh);
+	}
+	else if (replace_var(arg, &(sh->global), LOCAL, sh) == -1
+		&& ft_limbo_import(sh, arg) == -1)
+		replace_var(arg, &(sh->local), DEFAULT, sh);
+}
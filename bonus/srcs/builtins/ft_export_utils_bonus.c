@@ -54,6 +54,7 @@ void	ft_clear_limbo(char *arg, t_shell *sh)
  * The first character must be alphabetic or an underscore;
  * subsequent characters may include alphanumeric, underscore, or a plus sign
  * (`+`) only if it is followed by an equals sign (`=`).
+ * Array assignment words (see `ft_array_form`) are accepted as they are.
  *
  * @param argv Array of argument strings to validate.
  * @return 0 if all identifiers are valid, or an error message and non-zero
@@ -66,7 +67,9 @@ int	ft_check_keys_argv(char **argv)
 	while (*argv)
 	{
 		i = 0;
-		if (!ft_isalpha((*argv)[i]) && (*argv)[i] != '_')
+		if (ft_array_form(*argv))
+			i = ft_strlen(*argv);
+		else if (!ft_isalpha((*argv)[i]) && (*argv)[i] != '_')
 			return (ft_stderror(FALSE, ERROR_IDENTIFIER, (*argv)), 1);
 		while ((*argv)[i] != '=' && (*argv)[i])
 		{
@@ -0,0 +1,119 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_hash_bonus.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: joneves- <joneves-@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by joneves-          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by joneves-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell_bonus.h"
+
+/**
+ * @brief Prints the remembered commands, as `hash` does without arguments.
+ *
+ * Names remembered as not found are not listed.
+ *
+ * @param map The hash table.
+ */
+static void	ft_hash_print(t_hmap *map)
+{
+	t_hentry	*entry;
+	size_t		i;
+	bool		empty;
+
+	empty = true;
+	i = 0;
+	while (i < map->size)
+	{
+		entry = map->buckets[i++];
+		while (entry)
+		{
+			if (*entry->value && empty)
+				printf("hits\tcommand\n");
+			if (*entry->value)
+				printf("%4zu\t%s\n", entry->hits, entry->value);
+			if (*entry->value)
+				empty = false;
+			entry = entry->next;
+		}
+	}
+	if (empty)
+		printf("hash: hash table empty\n");
+}
+
+/**
+ * @brief Handles one name given to `hash`.
+ *
+ * Without option the name is searched in PATH again and remembered, `-d`
+ * forgets it and `-t` prints its remembered path.
+ *
+ * @param name The command name.
+ * @param opt The option letter (`d`, `t`), or 0.
+ * @param sh A pointer to the shell structure holding the hash table.
+ */
+static void	ft_hash_name(char *name, char opt, t_shell *sh)
+{
+	size_t	*hits;
+	char	*path;
+
+	path = ft_hmap_get(&sh->hash, name);
+	if (opt == 0 && !ft_strchr(name, '/'))
+	{
+		ft_hmap_del(&sh->hash, name);
+		hits = ft_hash_lookup(name, sh);
+		if (hits)
+			*hits = 0;
+		path = ft_hmap_get(&sh->hash, name);
+	}
+	if ((!path || !*path) && !ft_strchr(name, '/'))
+	{
+		ft_stderror(FALSE, "hash: %s: not found", name);
+		ft_exit_status(1, TRUE, FALSE);
+	}
+	if (opt == 'd' || !path || !*path)
+		ft_hmap_del(&sh->hash, name);
+	else if (opt == 't')
+		printf("%s\n", path);
+}
+
+/**
+ * @brief Executes the `hash` builtin.
+ *
+ * Without arguments, lists the remembered commands and their number of
+ * uses. `-r` forgets every command, and `-d` or `-t` apply to the names
+ * that follow.
+ *
+ * @param argc The number of arguments.
+ * @param argv The arguments, starting with `hash`.
+ * @param sh A pointer to the shell structure holding the hash table.
+ * @return The exit status.
+ */
+int	ft_hash(int argc, char **argv, t_shell *sh)
+{
+	char	opt;
+	int		i;
+
+	ft_exit_status(0, TRUE, FALSE);
+	if (argc == 1)
+		return (ft_hash_print(&sh->hash), 0);
+	opt = 0;
+	i = 1;
+	if (!ft_strcmp(argv[i], "-r"))
+		ft_hash_clear(sh);
+	else if (!ft_strcmp(argv[i], "-d") || !ft_strcmp(argv[i], "-t"))
+		opt = argv[i][1];
+	else if (argv[i][0] == '-' && argv[i][1])
+	{
+		ft_stderror(FALSE, "hash: %s: invalid option", argv[i]);
+		return (ft_exit_status(2, TRUE, FALSE));
+	}
+	if (opt || !ft_strcmp(argv[i], "-r"))
+		i++;
+	while (i < argc)
+		ft_hash_name(argv[i++], opt, sh);
+	return (ft_exit_status(0, FALSE, FALSE));
+}
@@ -0,0 +1,146 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_jobs_bonus.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: joneves- <joneves-@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by joneves-          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by joneves-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell_bonus.h"
+
+/**
+ * @brief Returns the marker of a job: `+` for the current job, `-` for the
+ *        previous one and a space for the others.
+ *
+ * @param job The job.
+ * @param sh A pointer to the shell structure holding the job list.
+ * @return The marker character.
+ */
+static char	ft_jobs_mark(t_job *job, t_shell *sh)
+{
+	if (ft_bg_find("%+", sh) == job)
+		return ('+');
+	if (ft_bg_find("%-", sh) == job)
+		return ('-');
+	return (' ');
+}
+
+/**
+ * @brief Describes the state of a job as bash does.
+ *
+ * @param job The job.
+ * @return `Running`, `Done`, `Exit N` or the description of the signal that
+ *         killed it, allocated.
+ */
+static char	*ft_jobs_state(t_job *job)
+{
+	char	*code;
+	char	*state;
+
+	if (!job->done)
+		return (ft_strdup("Running"));
+	if (WIFSIGNALED(job->status))
+		return (ft_strdup(strsignal(WTERMSIG(job->status))));
+	if (WEXITSTATUS(job->status) == 0)
+		return (ft_strdup("Done"));
+	code = ft_itoa(WEXITSTATUS(job->status));
+	state = ft_strjoin("Exit ", code);
+	free(code);
+	return (state);
+}
+
+/**
+ * @brief Prints one line of the job list.
+ *
+ * @param job The job to print.
+ * @param pid `true` to include the pid of the job, as `jobs -l` does.
+ * @param out The stream to print to.
+ * @param sh A pointer to the shell structure holding the job list.
+ */
+void	ft_jobs_print(t_job *job, bool pid, FILE *out, t_shell *sh)
+{
+	char	*state;
+
+	state = ft_jobs_state(job);
+	if (!state)
+		return (ft_error_malloc("jobs"));
+	fprintf(out, "[%d]%c ", job->id, ft_jobs_mark(job, sh));
+	if (pid)
+		fprintf(out, "%d", job->pid);
+	fprintf(out, " %-24s%s", state, job->cmd);
+	if (!job->done)
+		fprintf(out, " &");
+	fprintf(out, "\n");
+	fflush(out);
+	free(state);
+}
+
+/**
+ * @brief Shows a job for the `jobs` builtin and forgets it if it finished.
+ *
+ * Only the shell that started a job can reap it; in a subshell (e.g.
+ * `jobs | cat`) the last known state is shown instead.
+ *
+ * @param job The job to show.
+ * @param mode `l` to include pids, `p` to print only the pid, or 0.
+ * @param sh A pointer to the shell structure holding the job list.
+ */
+static void	ft_jobs_show(t_job *job, char mode, t_shell *sh)
+{
+	bool	owner;
+
+	owner = (getpid() == sh->pid);
+	if (owner)
+		ft_bg_poll(job, WNOHANG);
+	if (mode == 'p')
+		printf("%d\n", job->pid);
+	else
+		ft_jobs_print(job, mode == 'l', stdout, sh);
+	if (owner && job->done)
+		ft_bg_remove(&sh->jobs, job);
+}
+
+/**
+ * @brief Implements the `jobs` builtin.
+ *
+ * Lists the background jobs, or the ones given as job specifications, with
+ * their state. `-l` adds the pids and `-p` prints only the pids. Jobs that
+ * have finished are reported once and then forgotten.
+ *
+ * @param argc The number of arguments.
+ * @param argv The arguments, starting with `jobs`.
+ * @param sh A pointer to the shell structure holding the job list.
+ * @return The exit status of the builtin.
+ */
+int	ft_jobs(int argc, char **argv, t_shell *sh)
+{
+	t_list	*curr;
+	t_job	*job;
+	char	mode;
+	int		i;
+
+	mode = 0;
+	i = 1;
+	if (argc > 1 && (!ft_strcmp(argv[1], "-l") || !ft_strcmp(argv[1], "-p")))
+		mode = argv[i++][1];
+	else if (argc > 1 && argv[1][0] == '-' && argv[1][1])
+		return (ft_stderror(FALSE, "jobs: %s: invalid option", argv[1]),
+			ft_stderror(FALSE, JOBS_USAGE), ft_exit_status(2, TRUE, FALSE));
+	while (i < argc && ft_bg_find(argv[i], sh))
+		ft_jobs_show(ft_bg_find(argv[i++], sh), mode, sh);
+	if (i < argc)
+		return (ft_stderror(FALSE, "jobs: %s: no such job", argv[i]),
+			ft_exit_status(1, TRUE, FALSE));
+	curr = sh->jobs;
+	while (argc == 1 + (mode != 0) && curr)
+	{
+		job = (t_job *)curr->content;
+		curr = curr->next;
+		ft_jobs_show(job, mode, sh);
+	}
+	return (ft_exit_status(0, TRUE, FALSE));
+}
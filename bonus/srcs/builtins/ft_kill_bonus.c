@@ -0,0 +1,117 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_kill_bonus.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: joneves- <joneves-@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by joneves-          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by joneves-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell_bonus.h"
+
+/**
+ * @brief Parses the signal option of `kill`.
+ *
+ * Accepts `-s name`, `-n number`, `-name` and `-number`; `--` ends the
+ * options and keeps the default signal.
+ *
+ * @param argv The arguments of `kill`.
+ * @param i A pointer to the index of the option, moved past it.
+ * @param sig Set to the signal to send.
+ * @return `true` on success, otherwise `false`, with the error reported.
+ */
+static bool	ft_kill_option(char **argv, int *i, int *sig)
+{
+	char	*spec;
+
+	spec = argv[*i] + 1;
+	if (!ft_strcmp(argv[(*i)++], "--"))
+		return (true);
+	if (!ft_strcmp(spec, "s") || !ft_strcmp(spec, "n"))
+	{
+		spec = argv[(*i)++];
+		if (!spec)
+			return (ft_stderror(FALSE, "kill: %s: option requires an argument",
+					argv[*i - 2]), ft_stderror(FALSE, KILL_USAGE),
+				ft_exit_status(2, TRUE, FALSE), false);
+	}
+	*sig = ft_kill_signum(spec);
+	if (*sig == -1)
+		return (ft_stderror(FALSE, "kill: %s: invalid signal specification",
+				spec), ft_exit_status(1, TRUE, FALSE), false);
+	return (true);
+}
+
+/**
+ * @brief Sends a signal to a process or to a background job.
+ *
+ * A job is signalled as a whole, through its process group, so that every
+ * command of a pipeline receives the signal.
+ *
+ * @param target A pid, or a job specification starting with `%`.
+ * @param sig The signal to send.
+ * @param sh A pointer to the shell structure holding the job list.
+ * @return 0 on success, 1 on failure.
+ */
+static int	ft_kill_send(char *target, int sig, t_shell *sh)
+{
+	t_job	*job;
+	pid_t	pid;
+	int		i;
+
+	job = ft_bg_find(target, sh);
+	if (target[0] == '%' && !job)
+		return (ft_stderror(FALSE, "kill: %s: no such job", target), 1);
+	i = (target[0] == '-');
+	while (ft_isdigit(target[i]))
+		i++;
+	if (!job && (target[i] || i == (target[0] == '-')))
+		return (ft_stderror(FALSE, KILL_TARGET, target), 1);
+	pid = ft_atoi(target);
+	if (job)
+		pid = -job->pid;
+	if (kill(pid, sig) == -1)
+		return (ft_stderror(FALSE, "kill: (%s) - %s", target,
+				strerror(errno)), 1);
+	return (0);
+}
+
+/**
+ * @brief Implements the `kill` builtin.
+ *
+ * Sends a signal (SIGTERM by default) to each pid or job given, from within
+ * the shell: it does not fork, so it works even when no more processes can
+ * be created. `kill -l` lists the signal names, or translates each operand.
+ *
+ * @param argc The number of arguments.
+ * @param argv The arguments, starting with `kill`.
+ * @param sh A pointer to the shell structure holding the job list.
+ * @return The exit status of the builtin.
+ */
+int	ft_kill(int argc, char **argv, t_shell *sh)
+{
+	int	i;
+	int	sig;
+	int	status;
+
+	if (argc > 1 && !ft_strcmp(argv[1], "-l"))
+		return (ft_exit_status(ft_kill_list(argv + 2), TRUE, FALSE));
+	sig = SIGTERM;
+	i = 1;
+	if (argc > 1 && argv[1][0] == '-' && ft_isalnum(argv[1][1])
+		&& !ft_kill_option(argv, &i, &sig))
+		return (ft_exit_status(0, FALSE, FALSE));
+	if (argc > 1 && !ft_strcmp(argv[1], "--"))
+		i = 2;
+	if (i >= argc)
+		return (ft_stderror(FALSE, KILL_USAGE),
+			ft_exit_status(2, TRUE, FALSE));
+	status = 0;
+	while (i < argc)
+		if (ft_kill_send(argv[i++], sig, sh))
+			status = 1;
+	return (ft_exit_status(status, TRUE, FALSE));
+}
@@ -0,0 +1,124 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_kill_utils_bonus.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: joneves- <joneves-@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by joneves-          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by joneves-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell_bonus.h"
+
+/**
+ * @brief Converts a signal specification into a signal number.
+ *
+ * A specification is a number or a signal name, with or without the `SIG`
+ * prefix (`9`, `KILL` or `SIGKILL`).
+ *
+ * @param spec The signal specification.
+ * @return The signal number, or -1 if the specification is invalid.
+ */
+int	ft_kill_signum(char *spec)
+{
+	char	**names;
+	int		i;
+	int		num;
+
+	if (!ft_strncmp(spec, "SIG", 3))
+		spec += 3;
+	i = 0;
+	while (ft_isdigit(spec[i]))
+		i++;
+	num = -1;
+	if (i > 0 && i < 3 && !spec[i] && ft_atoi(spec) < NSIG)
+		return (ft_atoi(spec));
+	names = ft_split(SIGNAL_NAMES, ' ');
+	i = 0;
+	while (names && names[i] && num == -1)
+	{
+		if (!ft_strcmp(names[i], spec))
+			num = i + 1;
+		i++;
+	}
+	ft_free_vector(names);
+	return (num);
+}
+
+/**
+ * @brief Prints the table of signals for `kill -l`.
+ *
+ * @param names The signal names, in the order of their numbers.
+ */
+static void	ft_kill_table(char **names)
+{
+	int	i;
+
+	i = 0;
+	while (names[i])
+	{
+		printf("%2d) SIG%s", i + 1, names[i]);
+		i++;
+		if (i % 5 == 0 || !names[i])
+			printf("\n");
+		else
+			printf("\t");
+	}
+}
+
+/**
+ * @brief Prints the name or the number of one signal, for `kill -l`.
+ *
+ * The names already printed are flushed before an error is reported, so
+ * both come out in order.
+ *
+ * @param arg A signal number (or an exit status above 128), or a name.
+ * @param names The signal names, in order.
+ * @return 0 on success, 1 if `arg` is not a signal.
+ */
+static int	ft_kill_name(char *arg, char **names)
+{
+	int	num;
+
+	num = ft_kill_signum(arg);
+	if (ft_isdigit(arg[0]))
+		num = ft_atoi(arg) % 128;
+	if (ft_isdigit(arg[0]) && num > 0 && num <= SIGSYS)
+		printf("%s\n", names[num - 1]);
+	else if (!ft_isdigit(arg[0]) && num > 0)
+		printf("%d\n", num);
+	else
+		return (fflush(stdout), ft_stderror(FALSE,
+				"kill: %s: invalid signal specification", arg), 1);
+	return (0);
+}
+
+/**
+ * @brief Implements `kill -l`.
+ *
+ * Without an argument, lists the signals with their numbers. Otherwise,
+ * prints the name of each signal number (or exit status above 128) given,
+ * and the number of each signal name, one per line.
+ *
+ * @param args The NULL-terminated operands following `-l`.
+ * @return The exit status of the builtin: 1 if an operand is not a signal.
+ */
+int	ft_kill_list(char **args)
+{
+	char	**names;
+	int		status;
+
+	names = ft_split(SIGNAL_NAMES, ' ');
+	if (!names)
+		return (ft_error_malloc("kill"), 1);
+	if (!*args)
+		return (ft_kill_table(names), ft_free_vector(names), 0);
+	status = 0;
+	while (*args)
+		if (ft_kill_name(*args++, names))
+			status = 1;
+	ft_free_vector(names);
+	return (status);
+}
@@ -0,0 +1,65 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_loadable_abi_bonus.c                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: joneves- <joneves-@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by joneves-          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by joneves-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell_bonus.h"
+
+/**
+ * @brief Gets the value of a shell variable, for loadable builtins.
+ *
+ * @param sh The shell passed to the builtin.
+ * @param name The variable name.
+ * @return The value, owned by the shell, or NULL if the variable is unset.
+ */
+char	*ft_ld_getvar(t_shell *sh, char *name)
+{
+	return (ft_getvar(name, ft_strlen(name), sh));
+}
+
+/**
+ * @brief Sets a shell variable, for loadable builtins.
+ *
+ * The assignment behaves like `name=value` typed at the prompt: an exported
+ * variable stays exported, and any other becomes a local variable.
+ *
+ * @param sh The shell passed to the builtin.
+ * @param name The variable name.
+ * @param value The new value.
+ * @return 0 on success, or -1 if the name is not a valid identifier or memory
+ *         runs out.
+ */
+int	ft_ld_setvar(t_shell *sh, char *name, char *value)
+{
+	char	*arg;
+	size_t	i;
+
+	i = 0;
+	while (name[i] && (ft_isalnum(name[i]) || name[i] == '_'))
+		i++;
+	if (!i || name[i] || ft_isdigit(name[0]))
+		return (-1);
+	arg = merge(ft_strjoin(name, "="), value);
+	if (!arg)
+		return (ft_error_malloc("arg"), -1);
+	ft_assign_local(arg, sh);
+	free(arg);
+	return (0);
+}
+
+/**
+ * @brief Gets the exit status of the last command, for loadable builtins.
+ *
+ * @return The value of `$?`.
+ */
+int	ft_ld_status(void)
+{
+	return (ft_exit_status(0, FALSE, FALSE));
+}
@@ -0,0 +1,123 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_parallel_bonus.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: joneves- <joneves-@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by joneves-          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by joneves-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell_bonus.h"
+
+/**
+ * @brief Parses the `-j N` option of `parallel`.
+ *
+ * @param argv The arguments of `parallel`.
+ * @param i A pointer to the index of the next argument, moved past the
+ *        option.
+ * @param size Set to the number of jobs to run at once.
+ * @return `true` on success, otherwise `false`, with the error reported.
+ */
+static bool	ft_par_option(char **argv, int *i, int *size)
+{
+	char	*value;
+	int		len;
+
+	if (!argv[*i] || ft_strncmp(argv[*i], "-j", 2))
+		return (true);
+	value = argv[(*i)++] + 2;
+	if (!*value)
+		value = argv[(*i)++];
+	if (!value)
+		return (ft_stderror(FALSE, "parallel: -j: option requires an argument"),
+			ft_stderror(FALSE, PARALLEL_USAGE),
+			ft_exit_status(2, TRUE, FALSE), false);
+	len = 0;
+	while (ft_isdigit(value[len]))
+		len++;
+	if (!len || value[len] || len > 4 || ft_atoi(value) == 0)
+		return (ft_stderror(FALSE, "parallel: %s: invalid number of jobs",
+				value), ft_stderror(FALSE, PARALLEL_USAGE),
+			ft_exit_status(2, TRUE, FALSE), false);
+	*size = ft_atoi(value);
+	return (true);
+}
+
+/**
+ * @brief Collects the command lines of `parallel`.
+ *
+ * The lines are the remaining arguments or, if there are none, the lines of
+ * the standard input.
+ *
+ * @param argv The arguments of `parallel`.
+ * @param i The index of the first command line in `argv`.
+ * @return The command lines, NULL-terminated, or NULL on error.
+ */
+static char	**ft_par_lines(char **argv, int i)
+{
+	char	**cmds;
+	char	*input;
+	size_t	len;
+	int		n;
+
+	if (!argv[i])
+	{
+		input = ft_read_all(STDIN_FILENO, &len);
+		if (!input)
+			return (NULL);
+		cmds = ft_split(input, '\n');
+		return (free(input), cmds);
+	}
+	cmds = (char **)ft_calloc(ft_argslen(argv + i) + 1, sizeof(char *));
+	n = 0;
+	while (cmds && argv[i])
+	{
+		cmds[n] = ft_strdup(argv[i++]);
+		if (!cmds[n++])
+			return (ft_free_vector(cmds), NULL);
+	}
+	return (cmds);
+}
+
+/**
+ * @brief Implements the `parallel` builtin.
+ *
+ * Runs each command line given as an argument (or read from the standard
+ * input) with at most `-j N` of them at a time, one per CPU by default.
+ * The output of each job is buffered and emitted whole when it finishes.
+ * The status is the number of failed jobs, capped at 101 as in GNU parallel.
+ *
+ * @param argc The number of arguments.
+ * @param argv The arguments, starting with `parallel`.
+ * @param sh The shell structure.
+ * @return The exit status of the builtin.
+ */
+int	ft_parallel(int argc, char **argv, t_shell *sh)
+{
+	char	**cmds;
+	int		size;
+	int		failed;
+	int		i;
+
+	size = (int)sysconf(_SC_NPROCESSORS_ONLN);
+	i = 1;
+	if (!ft_par_option(argv, &i, &size))
+		return (2);
+	if (i < argc && !ft_strcmp(argv[i], "--"))
+		i++;
+	cmds = ft_par_lines(argv, i);
+	if (!cmds)
+		return (ft_error_malloc("parallel"), ft_exit_status(1, TRUE, FALSE));
+	if (ft_argslen(cmds) < size)
+		size = ft_argslen(cmds);
+	if (size < 1)
+		size = 1;
+	failed = ft_batch_run(cmds, size, sh);
+	ft_free_vector(cmds);
+	if (failed > 100)
+		failed = 101;
+	return (ft_exit_status(failed, TRUE, FALSE));
+}
@@ -0,0 +1,94 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_set_bonus.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: joneves- <joneves-@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by joneves-          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by joneves-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell_bonus.h"
+
+/**
+ * @brief Prints the shell options.
+ *
+ * With `-o`, each option is listed with its state; with `+o`, as the `set`
+ * command that restores it.
+ *
+ * @param sign The sign of the option flag, `-` or `+`.
+ * @param sh A pointer to the shell structure holding the options.
+ */
+static void	ft_set_print(char sign, t_shell *sh)
+{
+	char	*state;
+
+	state = "off";
+	if (sh->pipefail)
+		state = "on";
+	if (sign == '-')
+		printf("pipefail       \t%s\n", state);
+	else if (sh->pipefail)
+		printf("set -o pipefail\n");
+	else
+		printf("set +o pipefail\n");
+}
+
+/**
+ * @brief Turns a named shell option on or off.
+ *
+ * @param name The option name.
+ * @param sign `-` to turn the option on, `+` to turn it off.
+ * @param sh A pointer to the shell structure holding the options.
+ * @return `true` if the option exists, otherwise `false`.
+ */
+static bool	ft_set_option(char *name, char sign, t_shell *sh)
+{
+	if (ft_strcmp(name, "pipefail"))
+	{
+		ft_stderror(FALSE, "set: %s: invalid option name", name);
+		return (ft_exit_status(2, TRUE, FALSE), false);
+	}
+	sh->pipefail = (sign == '-');
+	return (true);
+}
+
+/**
+ * @brief Implements the `set` builtin for shell options.
+ *
+ * Only `-o name` and `+o name` are supported, and `pipefail` is the only
+ * option: when on, a pipeline's status is that of its rightmost failing
+ * stage. `-o` or `+o` without a name, or `set` alone, prints the options.
+ *
+ * @param argc The number of arguments.
+ * @param argv The arguments, starting with `set`.
+ * @param sh A pointer to the shell structure holding the options.
+ * @return The exit status of the builtin.
+ */
+int	ft_set(int argc, char **argv, t_shell *sh)
+{
+	int	i;
+
+	ft_exit_status(0, TRUE, FALSE);
+	if (argc == 1)
+		ft_set_print('+', sh);
+	i = 1;
+	while (i < argc)
+	{
+		if ((argv[i][0] != '-' && argv[i][0] != '+') || argv[i][1] != 'o'
+			|| argv[i][2])
+		{
+			ft_stderror(FALSE, "set: %s: invalid option", argv[i]);
+			ft_stderror(FALSE, SET_USAGE);
+			return (ft_exit_status(2, TRUE, FALSE));
+		}
+		if (!argv[i + 1])
+			ft_set_print(argv[i][0], sh);
+		else if (!ft_set_option(argv[i + 1], argv[i][0], sh))
+			return (2);
+		i += 2;
+	}
+	return (0);
+}
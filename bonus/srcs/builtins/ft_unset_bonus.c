@@ -120,7 +120,8 @@ static void	ft_delete(char *argv, char ***envp)
  * @brief Unsets specified variables from the shell environment.
  *
  * Iterates through the provided arguments and removes each variable from the
- * global, local, and limbo environment arrays if they exist.
+ * global, local, and limbo environment arrays if they exist. Array variables
+ * (or single elements, given as `name[sub]`) are removed as well.
  *
  * @param argc The number of arguments provided.
  * @param argv An array of argument strings, where each argument is the name of
@@ -139,6 +140,7 @@ int	ft_unset(int argc, char **argv, t_shell *sh)
 		ft_delete(*argv, &(sh->global));
 		ft_delete(*argv, &(sh->local));
 		ft_delete(*argv, &(sh->limbo));
+		ft_array_unset(*argv, sh);
 		argv++;
 	}
 	return (ft_exit_status(0, TRUE, FALSE));
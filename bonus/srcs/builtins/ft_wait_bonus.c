@@ -0,0 +1,98 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_wait_bonus.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: joneves- <joneves-@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by joneves-          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by joneves-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell_bonus.h"
+
+/**
+ * @brief Collects the status of a job `wait` has waited for.
+ *
+ * @param job The finished job, or NULL if the wait was interrupted.
+ * @param sh A pointer to the shell structure holding the job list.
+ * @return The exit status of the job, or -1 if the wait was interrupted.
+ */
+static int	ft_wait_done(t_job *job, t_shell *sh)
+{
+	int	code;
+
+	if (!job)
+		return (-1);
+	code = ft_job_code(job->status);
+	ft_bg_remove(&sh->jobs, job);
+	return (ft_exit_status(code, TRUE, FALSE));
+}
+
+/**
+ * @brief Waits for the job named by a pid or a job specification.
+ *
+ * @param spec The pid or job specification.
+ * @param sh A pointer to the shell structure holding the job list.
+ * @return The exit status of the job, or -1 if the wait was interrupted.
+ */
+static int	ft_wait_spec(char *spec, t_shell *sh)
+{
+	t_job	*job;
+	int		i;
+
+	job = ft_bg_find(spec, sh);
+	if (job)
+		return (ft_wait_done(ft_wait_job(job, sh->jobs), sh));
+	if (spec[0] == '%')
+		return (ft_stderror(FALSE, "wait: %s: no such job", spec),
+			ft_exit_status(127, TRUE, FALSE));
+	i = 0;
+	while (ft_isdigit(spec[i]))
+		i++;
+	if (spec[i] || i == 0)
+		return (ft_stderror(FALSE, WAIT_SPEC, spec),
+			ft_exit_status(2, TRUE, FALSE));
+	ft_stderror(FALSE, "wait: pid %s is not a child of this shell", spec);
+	return (ft_exit_status(127, TRUE, FALSE));
+}
+
+/**
+ * @brief Implements the `wait` builtin.
+ *
+ * Without arguments, waits for every background job and returns 0. With
+ * pids or job specifications, waits for each of them and returns the status
+ * of the last one. `-n` waits for the next job to finish and returns its
+ * status, or 127 if there are no jobs. Ctrl-C interrupts the wait with
+ * status 130.
+ *
+ * @param argc The number of arguments.
+ * @param argv The arguments, starting with `wait`.
+ * @param sh A pointer to the shell structure holding the job list.
+ * @return The exit status of the builtin.
+ */
+int	ft_wait(int argc, char **argv, t_shell *sh)
+{
+	int	i;
+
+	ft_exit_status(0, TRUE, FALSE);
+	if (argc > 1 && argv[1][0] == '-' && argv[1][1]
+		&& ft_strcmp(argv[1], "-n"))
+		return (ft_stderror(FALSE, "wait: %s: invalid option", argv[1]),
+			ft_stderror(FALSE, WAIT_USAGE), ft_exit_status(2, TRUE, FALSE));
+	if (argc > 1 && !ft_strcmp(argv[1], "-n") && !sh->jobs)
+		return (ft_exit_status(127, TRUE, FALSE));
+	if (argc > 1 && !ft_strcmp(argv[1], "-n"))
+		return (ft_wait_done(ft_wait_job(NULL, sh->jobs), sh));
+	while (argc == 1 && sh->jobs)
+		if (ft_wait_done(ft_wait_job(sh->jobs->content, sh->jobs), sh) == -1)
+			return (130);
+	i = 0;
+	while (++i < argc)
+		if (ft_wait_spec(argv[i], sh) == -1)
+			return (130);
+	if (argc == 1)
+		ft_exit_status(0, TRUE, FALSE);
+	return (ft_exit_status(0, FALSE, FALSE));
+}
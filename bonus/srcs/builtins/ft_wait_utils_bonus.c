@@ -0,0 +1,121 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_wait_utils_bonus.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: joneves- <joneves-@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by joneves-          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by joneves-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell_bonus.h"
+
+/**
+ * @brief Handler for SIGCHLD while `wait` is blocked.
+ *
+ * It does nothing: its only purpose is to make `sigsuspend` return when a
+ * child changes state.
+ *
+ * @param sig The signal number received.
+ */
+static void	ft_wait_sigchld(int sig)
+{
+	(void)sig;
+}
+
+/**
+ * @brief Checks whether a background job has finished.
+ *
+ * The job's process is reaped by pid, so other children are left alone. A
+ * job that is no longer a child (in a subshell, for example) counts as
+ * finished with status 127.
+ *
+ * @param job The job to check.
+ * @param options `WNOHANG` to only poll, or 0 to block until it finishes.
+ * @return `true` if the job has finished, otherwise `false`.
+ */
+bool	ft_bg_poll(t_job *job, int options)
+{
+	pid_t	pid;
+	int		status;
+
+	if (job->done)
+		return (true);
+	pid = waitpid(job->pid, &status, options);
+	if (pid == job->pid)
+		job->status = status;
+	else if (pid == -1 && errno != EINTR)
+		job->status = 127 << 8;
+	job->done = (pid == job->pid || (pid == -1 && errno != EINTR));
+	return (job->done);
+}
+
+/**
+ * @brief Polls the jobs `wait` is waiting for.
+ *
+ * @param target The job to wait for, or NULL for any job.
+ * @param jobs The job list.
+ * @return A finished job, or NULL if none has finished yet.
+ */
+static t_job	*ft_wait_ready(t_job *target, t_list *jobs)
+{
+	t_list	*curr;
+
+	if (target)
+	{
+		if (ft_bg_poll(target, WNOHANG))
+			return (target);
+		return (NULL);
+	}
+	curr = jobs;
+	while (curr)
+	{
+		if (ft_bg_poll((t_job *)curr->content, WNOHANG))
+			return ((t_job *)curr->content);
+		curr = curr->next;
+	}
+	return (NULL);
+}
+
+/**
+ * @brief Blocks until a job of a job list has finished.
+ *
+ * SIGCHLD is blocked while the jobs are polled and atomically unblocked by
+ * `sigsuspend`, so a job finishing between the two is never missed. Only
+ * the jobs are reaped, never other children of the shell. A SIGINT that
+ * sets the exit status to 130 interrupts the wait.
+ *
+ * @param target The job to wait for, or NULL for the first job to finish.
+ * @param jobs The job list: the background jobs, or the commands started
+ *        by `xargs`.
+ * @return The finished job, or NULL if the wait was interrupted.
+ */
+t_job	*ft_wait_job(t_job *target, t_list *jobs)
+{
+	struct sigaction	sa;
+	struct sigaction	old;
+	sigset_t			mask;
+	sigset_t			prev;
+	t_job				*done;
+
+	ft_memset(&sa, 0, sizeof(sa));
+	sa.sa_handler = ft_wait_sigchld;
+	sigemptyset(&sa.sa_mask);
+	sigaction(SIGCHLD, &sa, &old);
+	sigemptyset(&mask);
+	sigaddset(&mask, SIGCHLD);
+	pthread_sigmask(SIG_BLOCK, &mask, &prev);
+	mask = prev;
+	sigdelset(&mask, SIGCHLD);
+	done = ft_wait_ready(target, jobs);
+	while (!done && ft_exit_status(0, FALSE, FALSE) != 130)
+	{
+		sigsuspend(&mask);
+		done = ft_wait_ready(target, jobs);
+	}
+	pthread_sigmask(SIG_SETMASK, &prev, NULL);
+	sigaction(SIGCHLD, &old, NULL);
+	return (done);
+}
@@ -0,0 +1,153 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_xargs_bonus.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: joneves- <joneves-@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by joneves-          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by joneves-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell_bonus.h"
+
+/**
+ * @brief Parses the number given to the `-n` or `-P` option of `xargs`.
+ *
+ * @param argv The arguments of `xargs`.
+ * @param i A pointer to the index of the option, moved to its value when
+ *        the value is a separate argument.
+ * @param out Set to the number.
+ * @return `true` on success, otherwise `false`, with the error reported.
+ */
+static bool	ft_xargs_number(char **argv, int *i, int *out)
+{
+	char	*value;
+	char	*option;
+	int		len;
+
+	option = argv[*i];
+	value = option + 2;
+	if (!*value)
+		value = argv[++(*i)];
+	if (!value)
+		return (ft_stderror(FALSE, "xargs: %s: option requires an argument",
+				option), ft_stderror(FALSE, XARGS_USAGE), false);
+	len = 0;
+	while (ft_isdigit(value[len]))
+		len++;
+	if (!len || value[len] || len > 6 || ft_atoi(value) == 0)
+		return (ft_stderror(FALSE, "xargs: %s: invalid number", value),
+			ft_stderror(FALSE, XARGS_USAGE), false);
+	*out = ft_atoi(value);
+	return (true);
+}
+
+/**
+ * @brief Parses the options of `xargs`.
+ *
+ * @param argv The arguments of `xargs`.
+ * @param x The state of `xargs`, set from the options.
+ * @return The index of the command in `argv`, or -1 on error, with the
+ *         error reported.
+ */
+static int	ft_xargs_option(char **argv, t_xargs *x)
+{
+	bool	ok;
+	int		i;
+
+	i = 1;
+	ok = true;
+	while (ok && argv[i] && argv[i][0] == '-' && argv[i][1])
+	{
+		if (!ft_strcmp(argv[i], "--"))
+			return (i + 1);
+		if (!ft_strcmp(argv[i], "-0"))
+			x->nul = true;
+		else if (!ft_strcmp(argv[i], "-r"))
+			x->no_empty = true;
+		else if (!ft_strncmp(argv[i], "-n", 2))
+			ok = ft_xargs_number(argv, &i, &x->max_args);
+		else if (!ft_strncmp(argv[i], "-P", 2))
+			ok = ft_xargs_number(argv, &i, &x->procs);
+		else
+			ok = (ft_stderror(FALSE, "xargs: %s: invalid option", argv[i]),
+					ft_stderror(FALSE, XARGS_USAGE), false);
+		i++;
+	}
+	if (!ok)
+		return (-1);
+	return (i);
+}
+
+/**
+ * @brief Prepares the input buffer and the command of `xargs`.
+ *
+ * The program is looked up once, through the PATH hash table like any
+ * command the shell runs, and reused for every batch.
+ *
+ * @param x The state of `xargs`.
+ * @param sh A pointer to the shell structure.
+ * @return `true` on success, `false` if an allocation fails.
+ */
+static bool	ft_xargs_init(t_xargs *x, t_shell *sh)
+{
+	x->cap = XARGS_BUFFER;
+	x->buf = (char *)malloc(x->cap + 1);
+	if (!x->buf)
+		return (false);
+	x->envp = sh->global;
+	x->limit = ft_xargs_limit(x->envp, x->cmd);
+	if (ft_strchr(x->cmd[0], '/'))
+		x->path = ft_strdup(x->cmd[0]);
+	else
+	{
+		if (*x->cmd[0] && !ft_isbuiltin(x->cmd, sh))
+			x->hits = ft_hash_lookup(x->cmd[0], sh);
+		if (*x->cmd[0])
+			x->path = ft_hash_find(x->cmd[0], x->envp, sh);
+	}
+	return (true);
+}
+
+/**
+ * @brief Implements the `xargs` builtin.
+ *
+ * Reads items from the standard input and runs the command (`echo` by
+ * default) with as many of them as `ARG_MAX` allows per run, or at most
+ * `-n N`. With `-P N`, up to N runs happen at once. Items are separated by
+ * blanks and newlines, or by NUL bytes with `-0`; quotes are not special.
+ * The status follows GNU xargs: 123 if any run failed, 124 or 125 if one
+ * exited with 255 or was killed, and 126 or 127 if the command could not
+ * be run.
+ *
+ * @param argc The number of arguments.
+ * @param argv The arguments, starting with `xargs`.
+ * @param sh The shell structure.
+ * @return The exit status of the builtin.
+ */
+int	ft_xargs(int argc, char **argv, t_shell *sh)
+{
+	static char	*echo[] = {"echo", NULL};
+	t_xargs		x;
+	int			i;
+
+	(void)argc;
+	ft_memset(&x, 0, sizeof(t_xargs));
+	x.procs = 1;
+	i = ft_xargs_option(argv, &x);
+	if (i == -1)
+		return (ft_exit_status(2, TRUE, FALSE));
+	x.cmd = argv + i;
+	if (!argv[i])
+		x.cmd = echo;
+	ft_exit_status(0, TRUE, FALSE);
+	if (!ft_xargs_init(&x, sh))
+		return (ft_error_malloc("xargs"), ft_exit_status(1, TRUE, FALSE));
+	if (!ft_xargs_run(&x))
+		x.status = 1;
+	free(x.buf);
+	free(x.path);
+	return (ft_exit_status(x.status, TRUE, FALSE));
+}
@@ -0,0 +1,183 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_xargs_run_bonus.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: joneves- <joneves-@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by joneves-          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by joneves-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell_bonus.h"
+
+/**
+ * @brief Records how a command run by `xargs` ended.
+ *
+ * As in GNU xargs, a failure sets the status to 123, while a command that
+ * exits with 255 (124) or is killed by a signal (125) stops `xargs`. A
+ * command killed by SIGINT, which `xargs` got as well, gives 130 silently.
+ *
+ * @param x The state of `xargs`.
+ * @param status The raw wait status of the command.
+ */
+static void	ft_xargs_code(t_xargs *x, int status)
+{
+	if (WIFSIGNALED(status) && WTERMSIG(status) == SIGINT)
+	{
+		x->status = 130;
+		x->stop = true;
+	}
+	else if (WIFSIGNALED(status))
+	{
+		ft_stderror(FALSE, XARGS_KILLED, x->cmd[0], WTERMSIG(status));
+		x->status = 125;
+		x->stop = true;
+	}
+	else if (WEXITSTATUS(status) == 255)
+	{
+		ft_stderror(FALSE, XARGS_ABORT, x->cmd[0]);
+		x->status = 124;
+		x->stop = true;
+	}
+	else if (WEXITSTATUS(status) && x->status < 123)
+		x->status = 123;
+}
+
+/**
+ * @brief Waits for commands of `xargs` until at most `keep` are running.
+ *
+ * Only the commands of `xargs` are reaped (see `ft_wait_job`). If the wait
+ * is interrupted, the remaining commands, which got the same SIGINT, are
+ * still reaped, and no more batches are started.
+ *
+ * @param x The state of `xargs`.
+ * @param keep The number of commands that may keep running.
+ */
+static void	ft_xargs_reap(t_xargs *x, int keep)
+{
+	t_job	*job;
+
+	while (ft_lstsize(x->jobs) > keep)
+	{
+		job = ft_wait_job(NULL, x->jobs);
+		if (job)
+			ft_xargs_code(x, job->status);
+		else
+		{
+			job = (t_job *)x->jobs->content;
+			while (!ft_bg_poll(job, 0))
+				continue ;
+			x->status = 130;
+			x->stop = true;
+		}
+		ft_bg_remove(&x->jobs, job);
+	}
+}
+
+/**
+ * @brief Tracks a command started by `xargs` as one of its jobs.
+ *
+ * If the job cannot be recorded, the command is waited for right away.
+ *
+ * @param x The state of `xargs`.
+ * @param pid The process ID of the command.
+ */
+static void	ft_xargs_track(t_xargs *x, pid_t pid)
+{
+	t_list	*node;
+	t_job	*job;
+	int		status;
+
+	job = (t_job *)ft_calloc(1, sizeof(t_job));
+	node = NULL;
+	if (job)
+		node = ft_lstnew(job);
+	if (node)
+	{
+		job->pid = pid;
+		ft_lstadd_back(&x->jobs, node);
+		return ;
+	}
+	free(job);
+	ft_error_malloc("xargs");
+	waitpid(pid, &status, 0);
+	ft_xargs_code(x, status);
+}
+
+/**
+ * @brief Starts the command of `xargs` on the next batch.
+ *
+ * The program was resolved once for all batches, so each one costs a single
+ * `posix_spawn`. A failure to start it stops `xargs`.
+ *
+ * @param fa The file actions to apply in the new process.
+ * @param x The state of `xargs`.
+ */
+static void	ft_xargs_launch(posix_spawn_file_actions_t *fa, t_xargs *x)
+{
+	t_plan	plan;
+	pid_t	pid;
+
+	ft_memset(&plan, 0, sizeof(t_plan));
+	plan.argv = ft_xargs_batch(x);
+	if (!plan.argv)
+	{
+		ft_error_malloc("xargs");
+		x->status = 1;
+		x->stop = true;
+		return ;
+	}
+	plan.path = x->path;
+	plan.envp = x->envp;
+	plan.hits = x->hits;
+	pid = ft_spawn_run(&plan, fa);
+	free(plan.argv);
+	if (pid != -1)
+		return (ft_xargs_track(x, pid));
+	x->status = 126;
+	if (!x->path || access(x->path, F_OK) != 0)
+		x->status = 127;
+	x->stop = true;
+}
+
+/**
+ * @brief Runs the command of `xargs` on batches of the items read.
+ *
+ * Up to `-P` batches run at once; a new one is started as soon as one
+ * finishes. The commands read from `/dev/null`, so they cannot take the
+ * items of later batches. Without any item, the command runs once unless
+ * `-r` was given.
+ *
+ * @param x The state of `xargs`.
+ * @return `false` if the file actions cannot be set up, otherwise `true`.
+ */
+bool	ft_xargs_run(t_xargs *x)
+{
+	posix_spawn_file_actions_t	fa;
+	int							n;
+
+	if (posix_spawn_file_actions_init(&fa) != 0)
+		return (ft_error_malloc("file actions"), false);
+	n = -1;
+	if (posix_spawn_file_actions_addopen(&fa, STDIN_FILENO, "/dev/null",
+			O_RDONLY, 0) == 0)
+		n = ft_xargs_count(x);
+	else
+		ft_error_malloc("file actions");
+	if (n == 0 && !x->no_empty)
+		n = 1;
+	while (!x->stop && n > 0)
+	{
+		ft_xargs_launch(&fa, x);
+		ft_xargs_reap(x, x->procs - 1);
+		if (!x->stop)
+			n = ft_xargs_count(x);
+	}
+	if (n == -1)
+		x->status = 1;
+	ft_xargs_reap(x, 0);
+	posix_spawn_file_actions_destroy(&fa);
+	return (true);
+}
@@ -0,0 +1,189 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_xargs_utils_bonus.c                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: joneves- <joneves-@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by joneves-          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by joneves-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell_bonus.h"
+
+/**
+ * @brief Computes how many bytes of arguments a command run by `xargs` can
+ *        be given.
+ *
+ * `execve` fails with E2BIG when the argument and environment strings, with
+ * their pointers, exceed `ARG_MAX`. What the environment and the command
+ * itself take is subtracted, minus some headroom, so each batch can be as
+ * large as the current environment allows.
+ *
+ * @param envp The environment the commands run with.
+ * @param cmd The command and its initial arguments.
+ * @return The number of bytes left for the items read.
+ */
+size_t	ft_xargs_limit(char **envp, char **cmd)
+{
+	long	max;
+	size_t	used;
+	int		i;
+
+	max = sysconf(_SC_ARG_MAX);
+	if (max <= 0)
+		max = _POSIX_ARG_MAX;
+	used = XARGS_HEADROOM + 2 * sizeof(char *);
+	i = -1;
+	while (envp && envp[++i])
+		used += ft_strlen(envp[i]) + 1 + sizeof(char *);
+	i = -1;
+	while (cmd[++i])
+		used += ft_strlen(cmd[i]) + 1 + sizeof(char *);
+	if (used >= (size_t)max)
+		return (0);
+	return ((size_t)max - used);
+}
+
+/**
+ * @brief Reads more input into the buffer of `xargs`.
+ *
+ * The items already run are dropped first by moving the pending ones to the
+ * front, so the buffer only grows when a single batch does not fit in it.
+ *
+ * @param x The state of `xargs`.
+ * @return `true` on success, `false` if an allocation fails.
+ */
+static bool	ft_xargs_fill(t_xargs *x)
+{
+	ssize_t	rd;
+
+	ft_memmove(x->buf, x->buf + x->pos, x->len - x->pos);
+	x->len -= x->pos;
+	x->scan -= x->pos;
+	x->pos = 0;
+	if (x->len == x->cap)
+		x->buf = ft_grow_buffer(x->buf, x->len, &x->cap);
+	if (!x->buf)
+		return (false);
+	rd = -1;
+	while (rd == -1)
+	{
+		rd = read(STDIN_FILENO, x->buf + x->len, x->cap - x->len);
+		if (rd == -1 && errno != EINTR)
+			break ;
+	}
+	if (rd <= 0)
+		x->eof = true;
+	else
+		x->len += rd;
+	return (true);
+}
+
+/**
+ * @brief Finds the next complete item in the buffer of `xargs`.
+ *
+ * Items are separated by blanks and newlines, or only by NUL bytes with
+ * `-0`. The separator that ends an item is replaced by a NUL byte, so the
+ * item can be passed as an argument in place. Doing so again on the same
+ * item gives the same result.
+ *
+ * @param x The state of `xargs`.
+ * @param at A pointer to the offset to search from, moved to the item.
+ * @return The length of the item, or -1 if no complete item is buffered.
+ */
+static ssize_t	ft_xargs_item(t_xargs *x, size_t *at)
+{
+	size_t	end;
+
+	while (!x->nul && *at < x->len
+		&& (!x->buf[*at] || ft_isspace(x->buf[*at])))
+		(*at)++;
+	end = *at;
+	while (end < x->len && x->buf[end]
+		&& (x->nul || !ft_isspace(x->buf[end])))
+		end++;
+	if (end >= x->len && (!x->eof || end == *at))
+		return (-1);
+	x->buf[end] = '\0';
+	return (end - *at);
+}
+
+/**
+ * @brief Counts the items of the next batch of `xargs`, reading input as
+ *        needed.
+ *
+ * Items are added while their strings and pointers fit in the argument
+ * space left by the environment (see `ft_xargs_limit`) and `-n` allows it.
+ * The count is kept in the state, so input read in several steps is only
+ * scanned once.
+ *
+ * @param x The state of `xargs`.
+ * @return The number of items, or -1 if an item can never fit or an
+ *         allocation fails, with the error reported.
+ */
+int	ft_xargs_count(t_xargs *x)
+{
+	ssize_t	size;
+	size_t	at;
+	size_t	cost;
+
+	while (!x->max_args || x->n < x->max_args)
+	{
+		at = x->scan;
+		size = ft_xargs_item(x, &at);
+		if (size == -1 && x->eof)
+			break ;
+		if (size == -1 && !ft_xargs_fill(x))
+			return (ft_error_malloc("xargs"), -1);
+		if (size == -1)
+			continue ;
+		cost = size + 1 + sizeof(char *);
+		if (size >= XARGS_STRLEN || (!x->n && cost > x->limit))
+			return (ft_stderror(FALSE, XARGS_TOO_LONG), -1);
+		if (x->cost + cost > x->limit)
+			break ;
+		x->cost += cost;
+		x->scan = at + size + (at + size < x->len);
+		x->n++;
+	}
+	return (x->n);
+}
+
+/**
+ * @brief Builds the argument vector of the next batch of `xargs`.
+ *
+ * The command words are followed by the items counted by `ft_xargs_count`,
+ * which point into the input buffer, and the batch is consumed.
+ *
+ * @param x The state of `xargs`.
+ * @return The argument vector, owned by the caller but not its strings, or
+ *         NULL if the allocation fails.
+ */
+char	**ft_xargs_batch(t_xargs *x)
+{
+	char	**argv;
+	size_t	at;
+	ssize_t	size;
+	int		words;
+	int		i;
+
+	words = ft_argslen(x->cmd);
+	argv = (char **)ft_calloc(words + x->n + 1, sizeof(char *));
+	if (!argv)
+		return (NULL);
+	ft_memcpy(argv, x->cmd, words * sizeof(char *));
+	at = x->pos;
+	i = 0;
+	while (i < x->n)
+	{
+		size = ft_xargs_item(x, &at);
+		argv[words + i++] = x->buf + at;
+		at += size + 1;
+	}
+	x->pos = x->scan;
+	x->n = 0;
+	x->cost = 0;
+	return (argv);
+}
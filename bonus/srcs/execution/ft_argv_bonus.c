@@ -0,0 +1,112 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_argv_bonus.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: joneves- <joneves-@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by joneves-          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by joneves-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell_bonus.h"
+
+/**
+ * @brief Initializes an empty, NULL-terminated argument vector.
+ *
+ * Callers that know how many arguments they will push (e.g. one per token)
+ * pass that count so the vector is allocated once.
+ *
+ * @param argv The argument vector to initialize.
+ * @param cap The initial capacity, including the NULL terminator.
+ * @return `true` on success, `false` (with the error reported) if the
+ *         allocation fails.
+ */
+bool	ft_argv_init(t_argv *argv, size_t cap)
+{
+	argv->len = 0;
+	argv->cap = cap;
+	if (argv->cap < 2)
+		argv->cap = 2;
+	argv->v = (char **)malloc(sizeof(char *) * argv->cap);
+	if (!argv->v)
+		return (ft_error_malloc("argv"), false);
+	argv->v[0] = NULL;
+	return (true);
+}
+
+/**
+ * @brief Doubles the capacity of an argument vector.
+ *
+ * Growing geometrically keeps appending amortized constant time, where
+ * reallocating the vector for every new argument would make building a
+ * long argv quadratic.
+ *
+ * @param argv The argument vector to grow.
+ * @return `true` on success, `false` if the allocation fails.
+ */
+static bool	ft_argv_grow(t_argv *argv)
+{
+	char	**bigger;
+
+	bigger = (char **)malloc(sizeof(char *) * argv->cap * 2);
+	if (!bigger)
+		return (false);
+	ft_memcpy(bigger, argv->v, sizeof(char *) * (argv->len + 1));
+	free(argv->v);
+	argv->v = bigger;
+	argv->cap *= 2;
+	return (true);
+}
+
+/**
+ * @brief Appends a string to an argument vector, taking ownership of it.
+ *
+ * @param argv The argument vector.
+ * @param str The string to append; it is freed if it cannot be stored. A
+ *        NULL string is reported as an allocation failure.
+ */
+void	ft_argv_push(t_argv *argv, char *str)
+{
+	if (!str)
+		return (ft_error_malloc("argv"));
+	if (argv->len + 1 == argv->cap && !ft_argv_grow(argv))
+		return (free(str), ft_error_malloc("argv"));
+	argv->v[argv->len++] = str;
+	argv->v[argv->len] = NULL;
+}
+
+/**
+ * @brief Appends a word to an argument vector, expanding its wildcards.
+ *
+ * If `glob` is set and the word holds a `*`, the matching entries of the
+ * current directory are appended in alphabetical order instead. A pattern
+ * that matches nothing is appended as is.
+ *
+ * @param argv The argument vector.
+ * @param word The word to append (copied, not taken over).
+ * @param glob Whether the word is subject to wildcard expansion.
+ */
+void	ft_argv_glob(t_argv *argv, char *word, bool glob)
+{
+	t_list	**wild_list;
+	t_list	*curr;
+
+	wild_list = NULL;
+	if (glob && ft_strchr(word, '*'))
+		wild_list = ft_get_wildcard_list(word);
+	if (!wild_list || !*wild_list)
+	{
+		free(wild_list);
+		return (ft_argv_push(argv, ft_strdup(word)));
+	}
+	curr = *wild_list;
+	while (curr)
+	{
+		ft_argv_push(argv, ft_strdup(((t_token *)curr->content)->value));
+		curr = curr->next;
+	}
+	ft_free_list(*wild_list);
+	free(wild_list);
+}
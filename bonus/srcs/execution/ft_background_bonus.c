@@ -0,0 +1,163 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_background_bonus.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: joneves- <joneves-@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by joneves-          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by joneves-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell_bonus.h"
+
+/**
+ * @brief Finds the first background operator after a root node.
+ *
+ * @param root The root node that starts the current list.
+ * @param prev Set to the root node that precedes the operator.
+ * @return The `BG` root node that ends the list, or NULL if it runs in the
+ *         foreground.
+ */
+static t_node	*ft_bg_next(t_node *root, t_node **prev)
+{
+	t_node	*curr;
+
+	*prev = root;
+	curr = (t_node *)root->right;
+	while (curr && curr->type != BG)
+	{
+		*prev = curr;
+		curr = (t_node *)curr->right;
+	}
+	return (curr);
+}
+
+/**
+ * @brief Drops the here-documents of a background job from the shell's list.
+ *
+ * Here-documents are read for the whole line before anything runs, and each
+ * redirection takes the next file from the list. The job reads its own in
+ * the child, so the parent skips them, in the same order as
+ * `ft_search_heredoc`, to keep the list in step with the commands after `&`.
+ * The files are left for the child to open and remove.
+ *
+ * @param node The current node of the background job.
+ * @param sh The shell structure containing the heredoc list.
+ */
+static void	ft_bg_skip_heredocs(t_node *node, t_shell *sh)
+{
+	t_list	*tmp;
+
+	if (!node)
+		return ;
+	if (node->type == PIPE || node->type == ROOT || node->type == OR
+		|| node->type == AND || node->type == BG || node->type == SUB_ROOT)
+	{
+		ft_bg_skip_heredocs(node->left, sh);
+		return (ft_bg_skip_heredocs(node->right, sh));
+	}
+	if (((t_redir *)node)->type == HEREDOC && sh->heredoc_list
+		&& *sh->heredoc_list)
+	{
+		tmp = (*sh->heredoc_list)->next;
+		free((*sh->heredoc_list)->content);
+		free(*sh->heredoc_list);
+		*sh->heredoc_list = tmp;
+		ft_bg_skip_heredocs(((t_redir *)node)->next, sh);
+	}
+}
+
+/**
+ * @brief Runs a background job in the child process and exits.
+ *
+ * The job gets a process group of its own, so that keyboard signals meant
+ * for the foreground do not reach it, and reads from `/dev/null` unless it
+ * redirects its input. The list is cut at the `&` and run like a subshell.
+ *
+ * @param root The root node that starts the job.
+ * @param prev The last root node of the job.
+ * @param sh The shell structure containing the execution context and state.
+ */
+static void	ft_bg_child(t_node *root, t_node *prev, t_shell *sh)
+{
+	t_node	*bg;
+	int		fd;
+
+	setpgid(0, 0);
+	ft_signal(DEFAULT_);
+	close_original_fds(sh);
+	sh->fds_saved = 0;
+	fd = open("/dev/null", O_RDONLY);
+	if (fd != -1 && dup2(fd, STDIN_FILENO) != -1)
+		close(fd);
+	ft_lstclear(&sh->jobs, ft_bg_free);
+	ft_lstclear(&sh->stages, free);
+	bg = prev->right;
+	prev->right = NULL;
+	sh->tail = TRUE;
+	ft_launcher_manager(root, sh);
+	prev->right = bg;
+	ft_child_cleaner(sh, NULL, 0);
+	ft_exit_status(0, FALSE, TRUE);
+}
+
+/**
+ * @brief Records a background job in the parent after it was forked.
+ *
+ * @param root The root node that starts the job.
+ * @param prev The last root node of the job.
+ * @param pid The pid of the job's process.
+ * @param sh The shell structure holding the job list.
+ */
+static void	ft_bg_parent(t_node *root, t_node *prev, pid_t pid, t_shell *sh)
+{
+	t_node	*bg;
+	t_job	*job;
+
+	setpgid(pid, pid);
+	bg = prev->right;
+	prev->right = NULL;
+	ft_bg_skip_heredocs(root, sh);
+	job = ft_bg_add(sh, pid, ft_job_text(root, NULL));
+	prev->right = bg;
+	sh->last_bg = pid;
+	if (job && isatty(STDIN_FILENO))
+		ft_fprintf(STDERR_FILENO, "[%d] %d\n", job->id, pid);
+	ft_exit_status(0, TRUE, FALSE);
+}
+
+/**
+ * @brief Launches the list before a `&` operator as a background job.
+ *
+ * If the list that starts at `root` ends with `&`, it is forked without
+ * waiting for it, the job is recorded for `jobs`, `wait` and `kill` and
+ * `$!` is set to its pid; the commands after the `&` then run as usual.
+ * A `&` that ends the line leaves an empty root, which runs nothing.
+ *
+ * @param root The root node that starts the current list.
+ * @param sh The shell structure containing the execution context and state.
+ * @return `true` if the caller has nothing left to run for this root,
+ *         otherwise `false`.
+ */
+bool	ft_background(t_node *root, t_shell *sh)
+{
+	t_node	*prev;
+	t_node	*bg;
+	pid_t	pid;
+
+	if (!root->left)
+		return (true);
+	bg = ft_bg_next(root, &prev);
+	if (!bg || sh->run == FALSE)
+		return (false);
+	pid = fork();
+	if (pid == -1)
+		return (ft_stderror(TRUE, ""), ft_exit_status(1, TRUE, FALSE), true);
+	if (pid == 0)
+		ft_bg_child(root, prev, sh);
+	ft_bg_parent(root, prev, pid, sh);
+	ft_launcher_manager(bg, sh);
+	return (true);
+}
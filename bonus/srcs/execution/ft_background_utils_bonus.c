@@ -0,0 +1,142 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_background_utils_bonus.c                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: joneves- <joneves-@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by joneves-          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by joneves-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell_bonus.h"
+
+/**
+ * @brief Adds a background job to the job list.
+ *
+ * Jobs are numbered from one past the highest number in use, as in bash,
+ * so numbers are reused once the most recent jobs are gone.
+ *
+ * @param sh A pointer to the shell structure holding the job list.
+ * @param pid The pid of the job's process, which is also its process group.
+ * @param cmd The text of the job, allocated; the job takes ownership.
+ * @return The new job, or NULL if an allocation failed.
+ */
+t_job	*ft_bg_add(t_shell *sh, pid_t pid, char *cmd)
+{
+	t_job	*job;
+	t_list	*node;
+
+	job = (t_job *)ft_calloc(1, sizeof(t_job));
+	node = ft_lstnew(job);
+	if (!job || !node)
+		return (free(job), free(node), free(cmd),
+			ft_error_malloc("job list"), NULL);
+	job->id = 1;
+	if (sh->jobs)
+		job->id = ((t_job *)ft_lstlast(sh->jobs)->content)->id + 1;
+	job->pid = pid;
+	job->cmd = cmd;
+	ft_lstadd_back(&sh->jobs, node);
+	return (job);
+}
+
+/**
+ * @brief Finds a job from a pid or a job specification.
+ *
+ * `%n` names job `n`, `%%`, `%+` and `%` the current (most recent) job and
+ * `%-` the previous one; anything else is read as a pid.
+ *
+ * @param spec The pid or job specification.
+ * @param sh A pointer to the shell structure holding the job list.
+ * @return The job, or NULL if there is none.
+ */
+t_job	*ft_bg_find(char *spec, t_shell *sh)
+{
+	t_list	*curr;
+	t_job	*job;
+	int		n;
+
+	curr = sh->jobs;
+	n = -1;
+	if (!ft_strcmp(spec, "%") || !ft_strcmp(spec, "%%")
+		|| !ft_strcmp(spec, "%+"))
+		n = ft_lstsize(curr);
+	else if (!ft_strcmp(spec, "%-"))
+		n = ft_lstsize(curr) - 1;
+	while (curr)
+	{
+		job = (t_job *)curr->content;
+		if (spec[0] != '%' && job->pid == ft_atoi(spec))
+			return (job);
+		if (spec[0] == '%' && ft_isdigit(spec[1])
+			&& job->id == ft_atoi(spec + 1))
+			return (job);
+		if (--n == 0)
+			return (job);
+		curr = curr->next;
+	}
+	return (NULL);
+}
+
+/**
+ * @brief Frees a job, as the deletion function of the job list.
+ *
+ * @param content The job to free.
+ */
+void	ft_bg_free(void *content)
+{
+	if (!content)
+		return ;
+	free(((t_job *)content)->cmd);
+	free(content);
+}
+
+/**
+ * @brief Removes a job from a job list and frees it.
+ *
+ * @param jobs A pointer to the job list.
+ * @param job The job to remove.
+ */
+void	ft_bg_remove(t_list **jobs, t_job *job)
+{
+	t_list	**curr;
+	t_list	*node;
+
+	curr = jobs;
+	while (*curr && (*curr)->content != job)
+		curr = &(*curr)->next;
+	if (!*curr)
+		return ;
+	node = *curr;
+	*curr = node->next;
+	ft_lstdelone(node, ft_bg_free);
+}
+
+/**
+ * @brief Reports the background jobs that finished since the last prompt.
+ *
+ * Called before each prompt: finished jobs are reaped and, in an interactive
+ * shell, reported as `jobs` would and forgotten. A shell reading a script
+ * keeps them so that `wait` can still fetch their status.
+ *
+ * @param sh A pointer to the shell structure holding the job list.
+ */
+void	ft_bg_notify(t_shell *sh)
+{
+	t_list	*curr;
+	t_job	*job;
+
+	curr = sh->jobs;
+	while (curr)
+	{
+		job = (t_job *)curr->content;
+		curr = curr->next;
+		if (ft_bg_poll(job, WNOHANG) && isatty(STDIN_FILENO))
+		{
+			ft_jobs_print(job, false, stderr, sh);
+			ft_bg_remove(&sh->jobs, job);
+		}
+	}
+}
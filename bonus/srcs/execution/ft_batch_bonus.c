@@ -0,0 +1,193 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_batch_bonus.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: joneves- <joneves-@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by joneves-          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by joneves-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell_bonus.h"
+
+/**
+ * @brief Runs one line of a batch in the child process.
+ *
+ * Like a command substitution, the child drops the parent's command line and
+ * job tables and runs the already parsed line with its standard output on
+ * the job's pipe and its standard input on `/dev/null`, then exits with the
+ * resulting status. Its last command runs in tail position.
+ *
+ * @param tree The syntax tree of the line.
+ * @param fds The job's pipe.
+ * @param sh The shell structure.
+ */
+static void	ft_batch_child(void *tree, int *fds, t_shell *sh)
+{
+	int	fd;
+
+	ft_signal(DEFAULT_);
+	close(fds[0]);
+	if (dup2(fds[1], STDOUT_FILENO) == -1)
+		ft_stderror(TRUE, "");
+	close(fds[1]);
+	fd = open("/dev/null", O_RDONLY);
+	if (fd != -1 && dup2(fd, STDIN_FILENO) != -1)
+		close(fd);
+	close_original_fds(sh);
+	sh->fds_saved = 0;
+	sh->search_heredoc = FALSE;
+	sh->run = TRUE;
+	ft_lstclear(sh->heredoc_list, free);
+	ft_lstclear(&sh->stages, free);
+	ft_lstclear(&sh->jobs, ft_bg_free);
+	ft_free_tree(sh->root);
+	sh->root = tree;
+	sh->tail = TRUE;
+	ft_launcher_manager(sh->root, sh);
+	ft_child_cleaner(sh, NULL, 0);
+	ft_exit_status(0, FALSE, TRUE);
+}
+
+/**
+ * @brief Parses the next line of a batch and starts it in a free slot.
+ *
+ * The line is parsed once, in the shell, and the child inherits the tree. A
+ * line with a syntax error counts as a failed job without starting a
+ * process; a blank or comment line is skipped.
+ *
+ * @param line The command line.
+ * @param slot A free slot.
+ * @param sh The shell structure.
+ * @return 1 if the job was started, 0 if there was nothing to run, or -1 if
+ *         the job failed to start.
+ */
+static int	ft_batch_spawn(char *line, t_slot *slot, t_shell *sh)
+{
+	void	*tree;
+	int		fds[2];
+
+	ft_exit_status(0, TRUE, FALSE);
+	tree = ft_process_input(line);
+	if (!tree && ft_exit_status(0, FALSE, FALSE) != 0)
+		return (-1);
+	if (!tree)
+		return (0);
+	if (pipe(fds) == -1)
+		return (ft_stderror(TRUE, "parallel: "), ft_free_tree(tree), -1);
+	slot->pid = fork();
+	if (slot->pid == 0)
+		ft_batch_child(tree, fds, sh);
+	close(fds[1]);
+	ft_free_tree(tree);
+	if (slot->pid == -1)
+	{
+		slot->pid = 0;
+		return (ft_stderror(TRUE, "parallel: "), close(fds[0]), -1);
+	}
+	fcntl(fds[0], F_SETFD, FD_CLOEXEC);
+	slot->fd = fds[0];
+	return (1);
+}
+
+/**
+ * @brief Starts jobs until the batch is out of lines or of free slots.
+ *
+ * @param batch The batch being run.
+ * @param sh The shell structure.
+ */
+static void	ft_batch_fill(t_batch *batch, t_shell *sh)
+{
+	int	i;
+	int	started;
+
+	i = 0;
+	while (batch->cmds[batch->next] && batch->running < batch->size
+		&& i < batch->size)
+	{
+		if (batch->slots[i].fd != -1)
+		{
+			i++;
+			continue ;
+		}
+		started = ft_batch_spawn(batch->cmds[batch->next++],
+				&batch->slots[i], sh);
+		batch->running += (started == 1);
+		batch->failed += (started == -1);
+	}
+}
+
+/**
+ * @brief Waits for output from the running jobs and collects it.
+ *
+ * A single `poll` watches every running job, so the shell sleeps until one
+ * of them writes or exits. A job whose pipe reaches end-of-file is finished:
+ * its output is emitted and its slot freed for the next line.
+ *
+ * @param batch The batch being run.
+ */
+static void	ft_batch_poll(t_batch *batch)
+{
+	int	i;
+
+	i = -1;
+	while (++i < batch->size)
+	{
+		batch->pfds[i].fd = batch->slots[i].fd;
+		batch->pfds[i].events = POLLIN;
+		batch->pfds[i].revents = 0;
+	}
+	if (poll(batch->pfds, batch->size, -1) == -1)
+		return ;
+	i = -1;
+	while (++i < batch->size)
+	{
+		if (batch->pfds[i].revents && !ft_batch_read(&batch->slots[i]))
+		{
+			if (ft_batch_finish(&batch->slots[i]) != 0)
+				batch->failed++;
+			batch->running--;
+		}
+	}
+}
+
+/**
+ * @brief Runs command lines with at most `size` of them at a time.
+ *
+ * Each line runs in a child of its own, through the launcher, as soon as a
+ * slot is free; the output of each job is buffered and emitted whole when it
+ * finishes, in completion order.
+ *
+ * @param cmds The command lines, NULL-terminated.
+ * @param size The maximum number of jobs running at once.
+ * @param sh The shell structure.
+ * @return The number of jobs that failed.
+ */
+int	ft_batch_run(char **cmds, int size, t_shell *sh)
+{
+	t_batch	batch;
+	int		i;
+
+	ft_bzero(&batch, sizeof(t_batch));
+	batch.cmds = cmds;
+	batch.size = size;
+	batch.slots = (t_slot *)ft_calloc(size, sizeof(t_slot));
+	batch.pfds = (struct pollfd *)ft_calloc(size, sizeof(struct pollfd));
+	if (!batch.slots || !batch.pfds)
+		return (free(batch.slots), free(batch.pfds),
+			ft_error_malloc("parallel"), 1);
+	i = 0;
+	while (i < size)
+		batch.slots[i++].fd = -1;
+	while (batch.cmds[batch.next] || batch.running)
+	{
+		ft_batch_fill(&batch, sh);
+		if (batch.running)
+			ft_batch_poll(&batch);
+	}
+	free(batch.slots);
+	free(batch.pfds);
+	return (batch.failed);
+}
@@ -0,0 +1,80 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_batch_utils_bonus.c                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: joneves- <joneves-@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by joneves-          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by joneves-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell_bonus.h"
+
+/**
+ * @brief Reads the available output of a batch job into its buffer.
+ *
+ * The output is read straight into the job's growable buffer, so nothing is
+ * written to the terminal before the job is done.
+ *
+ * @param slot The slot of the running job.
+ * @return `true` while the job may still write, `false` at end-of-file or on
+ *         error.
+ */
+bool	ft_batch_read(t_slot *slot)
+{
+	ssize_t	rd;
+
+	if (!slot->buf)
+	{
+		slot->cap = CMDSUB_BUFFER;
+		slot->buf = (char *)malloc(slot->cap + 1);
+	}
+	else if (slot->len == slot->cap)
+		slot->buf = ft_grow_buffer(slot->buf, slot->len, &slot->cap);
+	if (!slot->buf)
+		return (ft_error_malloc("parallel"), false);
+	rd = read(slot->fd, slot->buf + slot->len, slot->cap - slot->len);
+	if (rd == -1 && errno == EINTR)
+		return (true);
+	if (rd <= 0)
+		return (false);
+	slot->len += rd;
+	return (true);
+}
+
+/**
+ * @brief Emits the output of a finished batch job and frees its slot.
+ *
+ * The whole output is written at once, so the lines of concurrent jobs never
+ * interleave. Closing the pipe first makes sure a job that is still writing
+ * (after a read error) cannot block the wait.
+ *
+ * @param slot The slot of the job.
+ * @return The exit status of the job.
+ */
+int	ft_batch_finish(t_slot *slot)
+{
+	size_t	done;
+	ssize_t	wr;
+	int		status;
+
+	close(slot->fd);
+	done = 0;
+	while (slot->buf && done < slot->len)
+	{
+		wr = write(STDOUT_FILENO, slot->buf + done, slot->len - done);
+		if (wr == -1 && errno != EINTR)
+			break ;
+		if (wr > 0)
+			done += wr;
+	}
+	status = 0;
+	while (waitpid(slot->pid, &status, 0) == -1 && errno == EINTR)
+		status = 0;
+	free(slot->buf);
+	ft_bzero(slot, sizeof(t_slot));
+	slot->fd = -1;
+	return (ft_job_code(status));
+}
@@ -0,0 +1,190 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_cmdsub_bonus.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: joneves- <joneves-@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by joneves-          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by joneves-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell_bonus.h"
+
+/**
+ * @brief Expands `$(< file)` by reading the file directly, without a fork.
+ *
+ * @param target The unexpanded file name.
+ * @param sh The shell structure holding the variable stores.
+ * @return The contents of the file without trailing newlines, or an empty
+ *         string (with the exit status set to 1) if it cannot be read.
+ */
+static char	*ft_cmdsub_file(char *target, t_shell *sh)
+{
+	char	*pathname;
+	char	*out;
+	int		fd;
+
+	pathname = ft_expand_word(target, sh, true);
+	free(target);
+	if (!pathname)
+		return (ft_error_malloc("pathname"), ft_strdup(""));
+	fd = open(pathname, O_RDONLY);
+	if (fd == -1)
+		return (ft_stderror(TRUE, "%s: ", pathname), free(pathname), \
+			ft_exit_status(1, TRUE, FALSE), ft_strdup(""));
+	out = ft_read_fd(fd);
+	close(fd);
+	free(pathname);
+	if (!out)
+		return (ft_error_malloc("out"), ft_strdup(""));
+	ft_exit_status(0, TRUE, FALSE);
+	return (out);
+}
+
+/**
+ * @brief Runs a substituted command in the child process.
+ *
+ * The child connects its end of the pipe to `target` (its standard output
+ * for command substitutions), parses the command as a new input line and
+ * runs it through `ft_launcher_manager`, then exits with the resulting
+ * status. The tree and job table of the parent's command line are released
+ * first, since the child never returns to them. For the same reason its last
+ * command runs in tail position.
+ *
+ * @param body The command text, freed by this function.
+ * @param fd The child's end of the pipe.
+ * @param target The standard stream the pipe end replaces.
+ * @param sh The shell structure.
+ */
+void	ft_cmdsub_child(char *body, int fd, int target, t_shell *sh)
+{
+	if (dup2(fd, target) == -1)
+		ft_stderror(TRUE, "");
+	close(fd);
+	close_original_fds(sh);
+	ft_procsub_close(sh);
+	sh->fds_saved = 0;
+	sh->search_heredoc = FALSE;
+	sh->run = TRUE;
+	ft_lstclear(sh->heredoc_list, free);
+	ft_lstclear(&sh->stages, free);
+	if (sh->root)
+		ft_free_tree(sh->root);
+	sh->root = ft_process_input(body);
+	free(body);
+	sh->tail = TRUE;
+	if (sh->root)
+		ft_launcher_manager(sh->root, sh);
+	ft_child_cleaner(sh, NULL, 0);
+	ft_exit_status(0, FALSE, TRUE);
+}
+
+/**
+ * @brief Collects the output of the substituted command.
+ *
+ * Reads the pipe until the child closes it, then waits for the child and
+ * records its exit status.
+ *
+ * @param pid The process ID of the child.
+ * @param fd The read end of the pipe.
+ * @return The captured output without trailing newlines.
+ */
+static char	*ft_cmdsub_wait(pid_t pid, int fd)
+{
+	char	*out;
+	int		status;
+
+	out = ft_read_fd(fd);
+	close(fd);
+	if (pid > 0 && waitpid(pid, &status, 0) != -1)
+	{
+		if (WIFEXITED(status))
+			ft_exit_status(WEXITSTATUS(status), TRUE, FALSE);
+		else if (WIFSIGNALED(status))
+			ft_exit_status(WTERMSIG(status) + 128, TRUE, FALSE);
+	}
+	if (!out)
+		return (ft_error_malloc("out"), ft_strdup(""));
+	return (out);
+}
+
+/**
+ * @brief Runs a command in a child process and captures its output.
+ *
+ * A single external command is spawned by `ft_cmdsub_spawn`; anything else
+ * runs in a forked copy of the shell.
+ *
+ * @param body The command text, freed by this function.
+ * @param sh The shell structure.
+ * @return The captured output without trailing newlines.
+ */
+static char	*ft_cmdsub_run(char *body, t_shell *sh)
+{
+	int		fds[2];
+	pid_t	pid;
+
+	if (pipe(fds) == -1)
+		return (free(body), ft_stderror(TRUE, ""), \
+			ft_exit_status(1, TRUE, FALSE), ft_strdup(""));
+	fflush(stdout);
+	pid = ft_cmdsub_spawn(body, fds, sh);
+	if (pid == 0)
+	{
+		pid = fork();
+		if (pid == -1)
+			return (free(body), close_fds(fds), ft_stderror(TRUE, ""), \
+				ft_exit_status(1, TRUE, FALSE), ft_strdup(""));
+		if (pid == 0)
+		{
+			close(fds[0]);
+			ft_cmdsub_child(body, fds[1], STDOUT_FILENO, sh);
+		}
+	}
+	free(body);
+	close(fds[1]);
+	return (ft_cmdsub_wait(pid, fds[0]));
+}
+
+/**
+ * @brief Expands a `$(...)` command substitution.
+ *
+ * The command runs in a child process whose standard output is a pipe, and
+ * the parent reads the pipe directly into a growable buffer. Trailing
+ * newlines are removed. An empty `$( )` expands to nothing without running
+ * anything. `$(< file)` is special-cased: the file is read by the shell
+ * itself, without forking. Unquoted results are split into fields by
+ * `tokentostring`. The shell's `subst` flag records that a command ran, for
+ * the status of an assignment-only command.
+ *
+ * @param value The string being expanded.
+ * @param i Pointer to the index of the `(` in `value`. It is updated to point
+ *        past the closing parenthesis.
+ * @param sh The shell structure.
+ * @return The newly allocated expansion.
+ */
+char	*ft_expand_cmdsub(char *value, int *i, t_shell *sh)
+{
+	char	*body;
+	char	*target;
+	int		end;
+
+	end = ft_find_next_brace(value, *i - 1);
+	if (end == -1)
+		return (ft_strdup("$"));
+	body = ft_substr(value, *i + 1, end - *i - 1);
+	*i = end + 1;
+	if (!body)
+		return (ft_error_malloc("body"), ft_strdup(""));
+	end = 0;
+	while (ft_isspace(body[end]))
+		end++;
+	if (!body[end])
+		return (free(body), ft_strdup(""));
+	sh->subst = true;
+	target = ft_cmdsub_target(body);
+	if (target)
+		return (free(body), ft_cmdsub_file(target, sh));
+	return (ft_cmdsub_run(body, sh));
+}
@@ -0,0 +1,107 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_cmdsub_spawn_bonus.c                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: joneves- <joneves-@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by joneves-          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by joneves-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell_bonus.h"
+
+/**
+ * @brief Finds the command of a tree made of a single simple command.
+ *
+ * @param root The root of the parsed substitution.
+ * @return The command node, or NULL if the tree has lists, pipes,
+ *         redirections or subshells.
+ */
+static t_exec	*ft_cmdsub_simple(t_node *root)
+{
+	t_node	*pipe;
+
+	if (root->right || !root->left)
+		return (NULL);
+	pipe = (t_node *)root->left;
+	if (pipe->type != PIPE || pipe->right || !pipe->left
+		|| ((t_node *)pipe->left)->type != EXEC)
+		return (NULL);
+	return ((t_exec *)pipe->left);
+}
+
+/**
+ * @brief Records the descriptor changes done by a spawned substitution.
+ *
+ * Besides the pipe, the descriptors of the pending process substitutions
+ * are closed, as `ft_cmdsub_child` does.
+ *
+ * @param fa The file actions to fill.
+ * @param fds The pipe read by the shell.
+ * @param sh A pointer to the shell structure.
+ * @return 0 on success, or an error number.
+ */
+static int	ft_cmdsub_actions(posix_spawn_file_actions_t *fa, int *fds, \
+	t_shell *sh)
+{
+	t_list	*curr;
+	int		err;
+	int		fd;
+
+	err = ft_spawn_actions(fa, fds, true);
+	curr = sh->procsub;
+	while (!err && curr)
+	{
+		fd = ((t_procsub *)curr->content)->fd;
+		if (fd != -1)
+			err = posix_spawn_file_actions_addclose(fa, fd);
+		curr = curr->next;
+	}
+	return (err);
+}
+
+/**
+ * @brief Runs a `$(...)` made of a single external command without forking
+ *        the shell.
+ *
+ * The body is parsed in the shell. When it is one simple command with an
+ * execution plan (see `ft_plan_build`), the program is spawned with its
+ * standard output on the pipe, so the cost does not depend on the size of
+ * the shell. Anything else is left to a forked child.
+ *
+ * @param body The command text.
+ * @param fds The pipe read by the shell.
+ * @param sh A pointer to the shell structure.
+ * @return The process ID, -1 if no process is needed (errors are already
+ *         reported), or 0 if the substitution must be forked.
+ */
+pid_t	ft_cmdsub_spawn(char *body, int *fds, t_shell *sh)
+{
+	posix_spawn_file_actions_t	fa;
+	t_plan						plan;
+	t_node						*root;
+	t_exec						*exec;
+	pid_t						pid;
+
+	root = (t_node *)ft_process_input(body);
+	if (!root)
+		return (-1);
+	pid = 0;
+	exec = ft_cmdsub_simple(root);
+	if (exec && ft_plan_build(&plan, exec, sh))
+	{
+		pid = -1;
+		plan.io[1] = fds[1];
+		if (posix_spawn_file_actions_init(&fa) == 0)
+		{
+			if (ft_cmdsub_actions(&fa, fds, sh) == 0)
+				pid = ft_spawn_run(&plan, &fa);
+			posix_spawn_file_actions_destroy(&fa);
+		}
+		ft_plan_free(&plan);
+	}
+	ft_free_tree(root);
+	return (pid);
+}
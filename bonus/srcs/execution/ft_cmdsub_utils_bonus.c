@@ -0,0 +1,131 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_cmdsub_utils_bonus.c                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: joneves- <joneves-@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by joneves-          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by joneves-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell_bonus.h"
+
+/**
+ * @brief Doubles the capacity of a read buffer.
+ *
+ * Growing geometrically keeps the total copying linear in the size of the
+ * data, even for multi-megabyte outputs.
+ *
+ * @param buf The current buffer, freed on success and on failure.
+ * @param len The number of bytes in use.
+ * @param cap Pointer to the current capacity, updated on success.
+ * @return The new buffer, or NULL if the allocation fails.
+ */
+char	*ft_grow_buffer(char *buf, size_t len, size_t *cap)
+{
+	char	*new_buf;
+
+	new_buf = (char *)malloc(*cap * 2 + 1);
+	if (!new_buf)
+		return (free(buf), NULL);
+	ft_memcpy(new_buf, buf, len);
+	free(buf);
+	*cap *= 2;
+	return (new_buf);
+}
+
+/**
+ * @brief Reads a file descriptor until end-of-file.
+ *
+ * The data is read straight into a growable buffer, which is always
+ * null-terminated.
+ *
+ * @param fd The file descriptor to read from.
+ * @param len Set to the number of bytes read.
+ * @return The data read, or NULL if an allocation fails.
+ */
+char	*ft_read_all(int fd, size_t *len)
+{
+	char	*buf;
+	size_t	cap;
+	ssize_t	rd;
+
+	cap = CMDSUB_BUFFER;
+	*len = 0;
+	buf = (char *)malloc(cap + 1);
+	rd = 1;
+	while (buf && (rd > 0 || (rd == -1 && errno == EINTR)))
+	{
+		if (*len == cap)
+			buf = ft_grow_buffer(buf, *len, &cap);
+		if (!buf)
+			break ;
+		rd = read(fd, buf + *len, cap - *len);
+		if (rd > 0)
+			*len += rd;
+	}
+	if (!buf)
+		return (NULL);
+	buf[*len] = '\0';
+	return (buf);
+}
+
+/**
+ * @brief Reads a file descriptor until end-of-file, dropping the trailing
+ *        newlines.
+ *
+ * Trailing newlines are dropped by moving the terminator back, without
+ * copying the data.
+ *
+ * @param fd The file descriptor to read from.
+ * @return The data read, without trailing newlines, or NULL if an
+ *         allocation fails.
+ */
+char	*ft_read_fd(int fd)
+{
+	char	*buf;
+	size_t	len;
+
+	buf = ft_read_all(fd, &len);
+	if (!buf)
+		return (NULL);
+	while (len > 0 && buf[len - 1] == '\n')
+		len--;
+	buf[len] = '\0';
+	return (buf);
+}
+
+/**
+ * @brief Extracts the file name of a `$(< file)` substitution.
+ *
+ * The substitution qualifies only when its body is a single input
+ * redirection: optional spaces, a `<` that does not start a heredoc, and a
+ * single word.
+ *
+ * @param body The text between the parentheses.
+ * @return A newly allocated copy of the (unexpanded) file name, or NULL if
+ *         the body is not a lone input redirection.
+ */
+char	*ft_cmdsub_target(char *body)
+{
+	char	*target;
+	int		i;
+
+	i = 0;
+	while (ft_isspace(body[i]))
+		i++;
+	if (body[i] != '<' || body[i + 1] == '<')
+		return (NULL);
+	target = ft_strtrim(body + i + 1, ISSPACE);
+	if (!target)
+		return (ft_error_malloc("target"), NULL);
+	i = 0;
+	while (target[i] && !ft_isspace(target[i]) && target[i] != SQUOTE
+		&& target[i] != DQUOTE && !ft_strchr(METACHARS, target[i]))
+		i++;
+	if (!target[0] || target[i])
+		return (free(target), NULL);
+	return (target);
+}
@@ -12,44 +12,14 @@
 
 #include "../../includes/minishell_bonus.h"
 
-/**
- * @brief Resolves the pathname for a command using provided paths.
- *
- * This function iterates through a list of paths, concatenates each path with 
- * the command, and checks if the resulting pathname is accessible and valid. 
- * If a valid pathname is found, it frees unused paths and returns the resolved 
- * pathname. If no valid pathname is found, all paths are freed, and `NULL` is 
- * returned.
- *
- * @param paths An array of paths to search for the command.
- * @param cmds An array of command arguments, where `cmds[0]` is the command name
- * @param sh A pointer to the shell structure for additional validation.
- * @return A valid pathname string for the command, or `NULL` if not found.
- */
-static char	*ft_handle_pathname(char **paths, char **cmds, t_shell *sh)
-{
-	char	*pathname;
-	int		i;
-
-	i = -1;
-	while (paths[++i])
-	{
-		pathname = merge(merge(paths[i], "/"), cmds[0]);
-		if (access(pathname, F_OK) == 0
-			&& isvalid_file(pathname, cmds, sh) == 0)
-			return (ft_free_paths(paths, i), pathname);
-		free(pathname);
-		pathname = NULL;
-	}
-	return (free(paths), NULL);
-}
-
 /**
  * @brief Finds the full path of a command in the system's PATH.
  *
  * Searches for the executable file of a command in the directories
  * listed in the system's PATH environment variable. It validates
- * the existence and executability of the command.
+ * the existence and executability of the command. The search goes through
+ * the shell's hash table (see `ft_hash_find`), so a command already looked
+ * up by the shell is not searched for again.
  *
  * @param envp An array of strings representing the environment variables.
  * @param cmds An array of strings representing the command and its arguments.
@@ -59,35 +29,59 @@ static char	*ft_handle_pathname(char **paths, char **cmds, t_shell *sh)
  */
 static char	*ft_findpath(char **envp, char **cmds, t_shell *sh)
 {
-	char	**paths;
-	char	*pathname;
-	int		i;
-
-	i = 0;
-	paths = NULL;
 	if (!*cmds[0])
 		return (NULL);
 	if (ft_strchr(cmds[0], '/') && isvalid_dir(cmds[0], cmds, sh) == 0)
 		return (ft_strdup(cmds[0]));
-	if (access(cmds[0], F_OK) == 0
-		&& isvalid_file(cmds[0], cmds, sh) == 0)
+	if (isvalid_file(cmds[0]) == 0)
 		return (ft_strdup(cmds[0]));
-	while (envp[i] && !ft_strnstr(envp[i], "PATH=", 5))
-		i++;
-	if (envp[i])
-		paths = ft_split(envp[i] + 5, ':');
-	if (!paths)
-		return (NULL);
-	pathname = ft_handle_pathname(paths, cmds, sh);
-	return (pathname);
+	return (ft_hash_find(cmds[0], envp, sh));
+}
+
+/**
+ * @brief Runs an assignment or a builtin in the shell.
+ *
+ * A command made only of assignments takes the status of its last command
+ * substitution, if any ran, like in bash. A builtin is run with its prefix
+ * assignments, unless one of them failed to expand.
+ *
+ * @param exec The command node.
+ * @param args The expanded arguments of the command.
+ * @param sh The shell structure containing the execution state and environment
+ */
+static void	ft_single_run(t_exec *exec, char **args, t_shell *sh)
+{
+	char	**words;
+	int		status;
+
+	if (exec->type == EXPORT || exec->type == EXPORT_AP)
+	{
+		status = ft_exit_status(0, FALSE, FALSE);
+		ft_export(ft_argslen(args), args, sh, LOCAL);
+		if (sh->subst && ft_exit_status(0, FALSE, FALSE) == 0)
+			ft_exit_status(status, TRUE, FALSE);
+		return ;
+	}
+	if (exec->type != EXEC || !ft_isbuiltin(args, sh))
+		return ;
+	words = ft_assign_words(exec->assigns, sh);
+	if (sh->expand_fail)
+		ft_exit_status(1, TRUE, FALSE);
+	else
+		ft_prefix_builtin(args, words, sh);
+	ft_free_vector(words);
 }
 
 /**
  * @brief Executes a single command if it is a built-in command.
  *
- * Checks if the given node is a built-in command, saves the original file
- * descriptors, processes redirections and arguments, and executes the command.
- * Restores the original file descriptors and returns the execution status.
+ * Checks if the given node is a built-in command, saves the standard file
+ * descriptors its redirections replace (see `ft_redir_plan`), processes
+ * redirections and arguments, and executes the command. Restores the
+ * original file descriptors and returns the execution status.
+ * Prefix assignments (`VAR=x builtin`) are only visible to the builtin.
+ * A command whose words failed to expand (see `expand_fail`) is not run
+ * and sets the exit status to 1.
  *
  * @param node The command node to be executed.
  * @param sh The shell structure containing the execution state and environment
@@ -98,66 +92,89 @@ int	ft_single_command(t_node *node, t_shell *sh)
 {
 	void	*curr;
 	char	**new_args;
-	int		argc;
 
-	if (ft_isjustbuiltin(node->left, sh))
-	{
-		ft_save_original_fds(sh);
-		curr = ((t_node *)node->left)->left;
-		while (ft_redir(((t_redir *)curr), sh))
-			curr = ((t_redir *)curr)->next;
-		ft_process_token_list(((t_exec *)curr)->args, \
-			ft_merge_env(sh->global, sh->local));
-		new_args = tokentostring(((t_exec *)curr)->args);
-		if (((t_exec *)curr)->type == EXPORT
-			|| ((t_exec *)curr)->type == EXPORT_AP)
-		{
-			argc = ft_argslen(new_args);
-			ft_export(argc, new_args, sh, LOCAL);
-		}
-		if (((t_exec *)curr)->type == EXEC)
-			if (ft_isbuiltin(new_args))
-				ft_exec_builtin(new_args, sh);
-		return (ft_free_vector(new_args), ft_restore_original_fds(sh), TRUE);
-	}
-	return (FALSE);
+	if (!ft_isjustbuiltin(node->left, sh))
+		return (FALSE);
+	if (sh->expand_fail)
+		return (ft_exit_status(1, TRUE, FALSE), TRUE);
+	curr = ((t_node *)node->left)->left;
+	ft_save_original_fds(sh, ft_redir_plan((t_node *)curr));
+	while (ft_redir(((t_redir *)curr), sh))
+		curr = ((t_redir *)curr)->next;
+	new_args = tokentostring(((t_exec *)curr)->args);
+	ft_single_run((t_exec *)curr, new_args, sh);
+	return (ft_free_vector(new_args), ft_restore_original_fds(sh), TRUE);
 }
 
 /**
- * @brief Executes a command in the shell.
+ * @brief Executes an external command, replacing the current process.
  *
- * Processes the list of args, checks if the command is a built-in function,
- * and executes it. If not, it finds the path of the command and executes it
- * using execve. Handles errors and sets the appropriate exit status.
+ * Finds the path of the command and executes it using execve, with the
+ * exported environment overlaid by the prefix assignments of the command.
+ * Only returns (with the child cleaned up and exited) on error.
  *
- * @param args A double pointer to the list of arguments.
+ * @param new_args The arguments of the command.
+ * @param words The prefix assignments of the command (may be NULL).
  * @param sh The shell structure containing environment variables and settings.
+ * @return The exit status, if the process did not exit.
  */
-int	ft_exec(t_list **args, t_shell *sh)
+static int	ft_exec_external(char **new_args, char **words, t_shell *sh)
 {
 	char	*pathname;
+	char	**envp;
+
+	envp = sh->global;
+	if (words)
+		envp = ft_overlay_env(sh->global, words);
+	if (!*new_args || !envp)
+		return (ft_child_cleaner(sh, new_args, 0), ft_free_vector(words), \
+			ft_exit_status(!envp, TRUE, TRUE));
+	pathname = ft_findpath(envp, new_args, sh);
+	if (!pathname)
+		return (ft_stderror(FALSE, "%s: command not found", new_args[0]), \
+			ft_child_cleaner(sh, new_args, 0), write(STDOUT_FILENO, "", 0), \
+			ft_exit_status(127, TRUE, TRUE));
+	if (execve(pathname, new_args, envp) == -1)
+		return (ft_stderror(TRUE, "%s: ", new_args[0]), \
+			ft_child_cleaner(sh, new_args, 0), free(pathname), \
+			ft_exit_status(1, TRUE, TRUE));
+	return (free(pathname), ft_exit_status(0, FALSE, FALSE));
+}
+
+/**
+ * @brief Executes a command in the shell.
+ *
+ * Processes the list of args, unless the parent already did it, checks if the
+ * command is a built-in function, and executes it. If not, it is executed by
+ * `ft_exec_external`. The prefix assignments of the command (`VAR=x cmd`), and
+ * those given to `env VAR=x cmd`, only apply to the environment of the command
+ * and never to the shell's own. The process ends with this command, so the
+ * argument strings are moved out of the tokens rather than copied. If a word
+ * failed to expand, nothing is run and the process exits with status 1.
+ *
+ * @param exec The executable node holding the list of arguments.
+ * @param sh The shell structure containing environment variables and settings.
+ */
+int	ft_exec(t_exec *exec, t_shell *sh)
+{
 	char	**new_args;
+	char	**words;
+	bool	direct;
 
-	pathname = NULL;
-	ft_process_token_list(args, ft_merge_env(sh->global, sh->local));
-	new_args = tokentostring(args);
-	if (ft_isbuiltin(new_args) && ft_exit_status(0, FALSE, FALSE) != 141)
-		ft_exec_builtin(new_args, sh);
+	sh->expand_fail = false;
+	if (!exec->expanded)
+		ft_process_token_list(exec->args, sh);
+	words = ft_assign_words(exec->assigns, sh);
+	new_args = ft_tokens_argv(exec->args, true);
+	if (sh->expand_fail)
+		return (ft_free_vector(words), ft_child_cleaner(sh, new_args, 0), \
+			ft_exit_status(1, TRUE, TRUE));
+	direct = ft_env_prefix(&new_args, &words);
+	if (!direct && ft_isbuiltin(new_args, sh)
+		&& ft_exit_status(0, FALSE, FALSE) != 141)
+		ft_prefix_builtin(new_args, words, sh);
 	else
-	{
-		if (!*new_args)
-			return (ft_child_cleaner(sh, new_args, 0), \
-				ft_exit_status(0, TRUE, TRUE));
-		pathname = ft_findpath(sh->global, new_args, sh);
-		if (!pathname)
-			return (ft_stderror(FALSE, "%s: command not found", new_args[0]), \
-				ft_child_cleaner(sh, new_args, 0), write(STDOUT_FILENO, "", 0), \
-				ft_exit_status(127, TRUE, TRUE));
-		if (execve(pathname, new_args, sh->global) == -1)
-			return (ft_stderror(TRUE, "%s: ", new_args[0]), \
-				ft_child_cleaner(sh, new_args, 0), free(pathname), \
-				ft_exit_status(1, TRUE, TRUE));
-		free(pathname);
-	}
+		ft_exec_external(new_args, words, sh);
+	ft_free_vector(words);
 	return (ft_child_cleaner(sh, new_args, 0), ft_exit_status(0, FALSE, TRUE));
 }
@@ -21,10 +21,10 @@
  *
  * @param eof The end-of-file delimiter string.
  * @param state The state indicating if env variable expansion is needed.
- * @param my_envp Array of environment variables for expansion.
+ * @param sh The shell structure holding the variable stores.
  * @param fd_write The file descriptor to write the input to.
  */
-static void	read_heredoc(char *eof, int state, char **my_envp, int fd_write)
+static void	read_heredoc(char *eof, int state, t_shell *sh, int fd_write)
 {
 	char	*input;
 
@@ -38,16 +38,15 @@ static void	read_heredoc(char *eof, int state, char **my_envp, int fd_write)
 		if (!input || !ft_strcmp(eof, input))
 		{
 			if (!input)
-				ft_stderror(FALSE, "warning: here-document at line %d"\
-				" delimited by end-of-file (wanted `%s')", count_line(0), eof);
+				ft_stderror(FALSE, HEREDOC_EOF, count_line(sh, 0), eof);
 			free(input);
 			break ;
 		}
 		add_history(input);
 		if (state == GENERAL)
-			input = ft_expand_input(input, my_envp);
+			input = ft_expand_input(input, sh);
 		ft_putendl_fd(input, fd_write);
-		count_line(1);
+		count_line(sh, 1);
 		if (input)
 			free(input);
 	}
@@ -122,13 +121,12 @@ static void	wait_heredoc(pid_t pid)
  * here-document content to a file and updates the shell state.
  *
  * @param eof The end-of-file delimiter string.
- * @param my_envp Array of environment variables for expansion.
  * @param state The state indicating if env variable expansion is needed.
  * @param sh The shell structure containing the here-document list.
  *
  * @return TRUE if the here-doc was successfully processed, FALSE otherwise.
  */
-static int	heredoc_fd(char *eof, char **my_envp, t_state state, t_shell *sh)
+static int	heredoc_fd(char *eof, t_state state, t_shell *sh)
 {
 	int		fd[2];
 	pid_t	pid;
@@ -142,9 +140,9 @@ static int	heredoc_fd(char *eof, char **my_envp, t_state state, t_shell *sh)
 	{
 		close(fd[0]);
 		ft_exit_status(0, TRUE, FALSE);
-		read_heredoc(eof, state, my_envp, fd[1]);
+		read_heredoc(eof, state, sh, fd[1]);
 		close(fd[1]);
-		ft_child_cleaner(sh, my_envp, 0);
+		ft_child_cleaner(sh, NULL, 0);
 		if (ft_exit_status(0, FALSE, FALSE) != 0)
 			ft_exit_status(130, TRUE, TRUE);
 		ft_exit_status(0, TRUE, TRUE);
@@ -152,9 +150,9 @@ static int	heredoc_fd(char *eof, char **my_envp, t_state state, t_shell *sh)
 	close(fd[1]);
 	wait_heredoc(pid);
 	if (ft_exit_status(0, FALSE, FALSE) != 0)
-		return (close(fd[0]), ft_free_vector(my_envp), FALSE);
-	save_heredoc(ft_create_pathname(), fd[0], sh);
-	return (close(fd[0]), ft_free_vector(my_envp), TRUE);
+		return (close(fd[0]), FALSE);
+	save_heredoc(ft_create_pathname(sh), fd[0], sh);
+	return (close(fd[0]), TRUE);
 }
 
 /**
@@ -175,7 +173,7 @@ void	ft_search_heredoc(t_node *node, t_shell *sh)
 	if (!node)
 		return ;
 	else if (node->type == PIPE || node->type == ROOT
-		|| node->type == OR || node->type == AND)
+		|| node->type == OR || node->type == AND || node->type == BG)
 	{
 		ft_search_heredoc(node->left, sh);
 		return (ft_search_heredoc(node->right, sh));
@@ -183,10 +181,9 @@ void	ft_search_heredoc(t_node *node, t_shell *sh)
 	else if (((t_redir *)node)->type == HEREDOC && sh->run == TRUE)
 	{
 		rnd = (t_redir *)node;
-		ft_process_token_list(rnd->target, ft_merge_env(sh->global, sh->local));
+		ft_process_token_list(rnd->target, sh);
 		tnd = (t_token *)(*rnd->target)->content;
-		sh->run = heredoc_fd(tnd->value, \
-			ft_merge_env(sh->global, sh->local), (t_state) tnd->state, sh);
+		sh->run = heredoc_fd(tnd->value, (t_state) tnd->state, sh);
 		ft_search_heredoc(((t_redir *)node)->next, sh);
 	}
 	else if (node->type == SUB_ROOT)
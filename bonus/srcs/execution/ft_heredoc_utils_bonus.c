@@ -21,17 +21,16 @@
  * @param new_value Pointer to the resulting string with quotes and expansions.
  * @param value The original string containing quotes and variables.
  * @param i Pointer to the current index in the original string.
- * @param envp Array of environment variables for expansion.
+ * @param sh The shell structure holding the variable stores.
  */
-void	ft_handle_quotes_hd(char **new_value, char *value, int *i, char **envp)
+void	ft_handle_quotes_hd(char **new_value, char *value, int *i, t_shell *sh)
 {
 	*new_value = ft_charjoin(*new_value, value[(*i)++]);
 	while (value[(*i)] && value[(*i)] != DQUOTE && value[(*i)] != SQUOTE)
 	{
-		if (value[(*i)] == '$'
-			&& ((ft_isalnum(value[(*i) + 1])
-					|| value[(*i) + 1] == '?' || value[(*i) + 1] == '_')))
-			ft_handle_expansion(new_value, value, i, envp);
+		if (value[(*i)] == '$' && (ft_isalnum(value[(*i) + 1])
+				|| value[(*i) + 1] == '_' || ft_is_expandable(&value[*i + 1])))
+			ft_handle_expansion(new_value, value, i, sh);
 		else
 			*new_value = ft_charjoin(*new_value, value[(*i)++]);
 	}
@@ -47,11 +46,11 @@ void	ft_handle_quotes_hd(char **new_value, char *value, int *i, char **envp)
  * special characters like '$'.
  *
  * @param input The original input string to be expanded.
- * @param envp Array of environment variables for expansion.
+ * @param sh The shell structure holding the variable stores.
  *
  * @return A newly allocated str with expanded variables and processed quotes.
  */
-char	*ft_expand_input(char *input, char **envp)
+char	*ft_expand_input(char *input, t_shell *sh)
 {
 	char	*new_input;
 	int		i;
@@ -61,10 +60,10 @@ char	*ft_expand_input(char *input, char **envp)
 	while (input[i])
 	{
 		if (input[i] == DQUOTE || input[i] == SQUOTE)
-			ft_handle_quotes_hd(&new_input, input, &i, envp);
+			ft_handle_quotes_hd(&new_input, input, &i, sh);
 		else if (input[i] == '$' && (ft_isalnum(input[i + 1])
-				|| input[i + 1] == '?' || input[i + 1] == '_'))
-			ft_handle_expansion(&new_input, input, &i, envp);
+				|| input[i + 1] == '_' || ft_is_expandable(&input[i + 1])))
+			ft_handle_expansion(&new_input, input, &i, sh);
 		else if (input[i] && input[i] != DQUOTE && input[i] != SQUOTE)
 			new_input = ft_charjoin(new_input, input[i++]);
 	}
@@ -73,58 +72,57 @@ char	*ft_expand_input(char *input, char **envp)
 }
 
 /**
- * @brief Manages and returns a static line counter.
+ * @brief Manages and returns the shell's line counter.
  *
  * Initializes the line counter if it is zero and increments the counter
  * when mode is set to 1. Returns the current value of the line counter.
  *
+ * @param sh The shell structure holding the line counter.
  * @param mode Determines if the line counter should be incremented 
  *             (1 to increment).
  *
  * @return The current value of the line counter.
  */
-int	count_line(int mode)
+int	count_line(t_shell *sh, int mode)
 {
-	static int	line;
-
-	if (line == 0)
-		line = 1;
+	if (sh->line == 0)
+		sh->line = 1;
 	if (mode == 1)
-		line++;
-	return (line);
+		sh->line++;
+	return (sh->line);
 }
 
 /**
  * @brief Creates a unique pathname for temporary files.
  *
  * This function generates a unique pathname in the /tmp directory, checking if
- * it already exists and incrementing a static counter until a unique pathname
- * is found. The generated pathname is returned to the caller.
+ * it already exists and incrementing the shell's counter until a unique
+ * pathname is found. The generated pathname is returned to the caller.
  *
+ * @param sh The shell structure holding the temporary file counter.
  * @return A pointer to the newly created pathname string. The caller is
  *         responsible for freeing this memory.
  */
-char	*ft_create_pathname(void)
+char	*ft_create_pathname(t_shell *sh)
 {
 	char		*base;
 	char		*pathname;
 	char		*temp;
-	static int	i;
 
 	base = "/tmp/.heredoc_";
 	while (1)
 	{
-		temp = ft_itoa(i);
+		temp = ft_itoa(sh->tmp_count);
 		pathname = ft_strjoin(base, temp);
 		if (access(pathname, F_OK) == -1)
 			break ;
 		free(temp);
 		free(pathname);
-		i++;
+		sh->tmp_count++;
 	}
 	free(temp);
 	unlink(pathname);
-	i++;
+	sh->tmp_count++;
 	return (pathname);
 }
 
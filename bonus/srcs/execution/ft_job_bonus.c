@@ -0,0 +1,128 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_job_bonus.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: joneves- <joneves-@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by joneves-          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by joneves-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell_bonus.h"
+
+/**
+ * @brief Records a pipeline stage in the job table.
+ *
+ * Every stage of the foreground pipeline is recorded in launch order, so its
+ * process can be reaped by pid and its status reported in `PIPESTATUS`. A
+ * stage that did not start a process (`pid` of -1, e.g. a command that was
+ * not found or a failed redirection) keeps the status it has already set.
+ *
+ * @param sh A pointer to the shell structure holding the job table.
+ * @param pid The pid of the stage's process, or -1 if none was started.
+ */
+void	ft_job_add(t_shell *sh, pid_t pid)
+{
+	t_stage	*stage;
+	t_list	*node;
+
+	stage = (t_stage *)malloc(sizeof(t_stage));
+	node = ft_lstnew(stage);
+	if (!stage || !node)
+	{
+		if (pid > 0)
+			waitpid(pid, NULL, 0);
+		return (free(stage), free(node), ft_error_malloc("job table"));
+	}
+	stage->pid = pid;
+	stage->status = 0;
+	if (pid <= 0)
+		stage->status = ft_exit_status(0, FALSE, FALSE);
+	ft_lstadd_back(&sh->stages, node);
+}
+
+/**
+ * @brief Converts a wait status into a shell exit status.
+ *
+ * @param status The status filled in by `waitpid`.
+ * @return The exit code of the process, or 128 plus the signal number if it
+ *         was killed by a signal.
+ */
+int	ft_job_code(int status)
+{
+	if (WIFSIGNALED(status))
+		return (WTERMSIG(status) + 128);
+	return (WEXITSTATUS(status));
+}
+
+/**
+ * @brief Waits for every stage of the foreground pipeline.
+ *
+ * Each recorded process is reaped by its own pid, so unrelated children of
+ * the shell (or of a host embedding it) are left alone. The exit status
+ * becomes that of the last stage or, with `set -o pipefail`, that of the
+ * rightmost stage that failed.
+ *
+ * @param sh A pointer to the shell structure holding the job table.
+ * @return `true` if the last stage was a process that has been waited for.
+ */
+bool	ft_job_wait(t_shell *sh)
+{
+	t_list	*curr;
+	t_stage	*stage;
+	int		status;
+	int		final;
+	bool	waited;
+
+	final = 0;
+	waited = false;
+	curr = sh->stages;
+	while (curr)
+	{
+		stage = (t_stage *)curr->content;
+		waited = (stage->pid > 0 && waitpid(stage->pid, &status, 0) != -1);
+		if (waited)
+			stage->status = ft_job_code(status);
+		stage->pid = -1;
+		if (!sh->pipefail || stage->status != 0)
+			final = stage->status;
+		curr = curr->next;
+	}
+	ft_exit_status(final, TRUE, FALSE);
+	return (waited);
+}
+
+/**
+ * @brief Publishes the statuses of the last pipeline and empties the table.
+ *
+ * Stores the status of every stage in the `PIPESTATUS` array; a command run
+ * without a pipeline (a builtin in the shell itself) leaves just `$?`. Any
+ * stage still running because the launch was cut short is reaped here.
+ *
+ * @param sh A pointer to the shell structure holding the job table.
+ */
+void	ft_job_finish(t_shell *sh)
+{
+	t_array	*arr;
+	t_list	*curr;
+	t_stage	*stage;
+
+	arr = ft_array_new("PIPESTATUS", 10, false, sh);
+	if (arr)
+		ft_array_clear(arr);
+	if (arr && !sh->stages)
+		ft_array_push(arr, ft_itoa(ft_exit_status(0, FALSE, FALSE)));
+	curr = sh->stages;
+	while (curr)
+	{
+		stage = (t_stage *)curr->content;
+		if (stage->pid > 0)
+			waitpid(stage->pid, NULL, 0);
+		if (arr)
+			ft_array_push(arr, ft_itoa(stage->status));
+		curr = curr->next;
+	}
+	ft_lstclear(&sh->stages, free);
+}
@@ -0,0 +1,149 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_job_text_bonus.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: joneves- <joneves-@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by joneves-          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by joneves-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell_bonus.h"
+
+/**
+ * @brief Appends a word to the text of a job, separated by a space.
+ *
+ * @param text The text built so far; it is freed and replaced.
+ * @param word The word to append.
+ * @return The new text, or NULL if an allocation failed.
+ */
+static char	*ft_text_add(char *text, char *word)
+{
+	size_t	len;
+
+	if (!text || !word)
+		return (text);
+	len = ft_strlen(text);
+	if (len && text[len - 1] != '(' && ft_strcmp(word, ")"))
+		text = merge(text, " ");
+	if (!text)
+		return (NULL);
+	return (merge(text, word));
+}
+
+/**
+ * @brief Returns the operator written in the command line for a node type.
+ *
+ * @param type The type of a redirection or of a root node.
+ * @return The operator as it appears in the command line.
+ */
+static char	*ft_text_symbol(int type)
+{
+	if (type == APPEND)
+		return (">>");
+	if (type == OUTFILE)
+		return (">");
+	if (type == HEREDOC)
+		return ("<<");
+	if (type == INFILE)
+		return ("<");
+	if (type == AND)
+		return ("&&");
+	if (type == OR)
+		return ("||");
+	return ("&");
+}
+
+/**
+ * @brief Appends the values of a token list to the text of a job.
+ *
+ * @param text The text built so far.
+ * @param list The token list, may be NULL.
+ * @return The new text.
+ */
+static char	*ft_text_list(char *text, t_list **list)
+{
+	t_list	*curr;
+
+	if (!list)
+		return (text);
+	curr = *list;
+	while (curr)
+	{
+		text = ft_text_add(text, ((t_token *)curr->content)->value);
+		curr = curr->next;
+	}
+	return (text);
+}
+
+/**
+ * @brief Appends one pipeline stage to the text of a job.
+ *
+ * The stage is written back in its usual order: the assignments and words
+ * of the command (or a subshell in parentheses), then its redirections.
+ *
+ * @param text The text built so far.
+ * @param node The stage: a redirection chain, a command or a subshell.
+ * @return The new text.
+ */
+static char	*ft_text_branch(char *text, void *node)
+{
+	char	*redirs;
+	char	*sub;
+
+	redirs = ft_strdup("");
+	while (node && ft_is_node_type(node, REDIR))
+	{
+		redirs = ft_text_add(redirs, ft_text_symbol(((t_redir *)node)->type));
+		redirs = ft_text_list(redirs, ((t_redir *)node)->target);
+		node = ((t_redir *)node)->next;
+	}
+	if (node && ((t_node *)node)->type == SUB_ROOT)
+	{
+		sub = ft_job_text(node, NULL);
+		text = ft_text_add(ft_text_add(text, "("), sub);
+		text = ft_text_add(text, ")");
+		free(sub);
+	}
+	else if (node)
+		text = ft_text_list(ft_text_list(text, ((t_exec *)node)->assigns),
+				((t_exec *)node)->args);
+	if (redirs && *redirs)
+		text = ft_text_add(text, redirs);
+	return (free(redirs), text);
+}
+
+/**
+ * @brief Rebuilds the command line of a job from its syntax tree.
+ *
+ * The text is what `jobs` and the completion notices show. It is built from
+ * the tokens as they were typed, before any expansion.
+ *
+ * @param root The first root node of the job.
+ * @param stop The root node that ends the job, or NULL for the whole list.
+ * @return The text of the job, allocated, or NULL if an allocation failed.
+ */
+char	*ft_job_text(t_node *root, t_node *stop)
+{
+	char	*text;
+	t_node	*pipe;
+
+	text = ft_strdup("");
+	while (root && root != stop)
+	{
+		pipe = (t_node *)root->left;
+		while (pipe)
+		{
+			text = ft_text_branch(text, pipe->left);
+			pipe = (t_node *)pipe->right;
+			if (pipe)
+				text = ft_text_add(text, "|");
+		}
+		root = (t_node *)root->right;
+		if (root && root != stop)
+			text = ft_text_add(text, ft_text_symbol(root->type));
+	}
+	return (text);
+}
@@ -40,13 +40,10 @@ pid_t	ft_child_process(int *fds, t_shell *sh, void *node, void *next_node)
 	{
 		close_original_fds(sh);
 		close(fds[0]);
-		if (next_node != NULL && (sh->prev && ((t_redir *)sh->prev)->type
-				!= OUTFILE) && ((t_redir *)sh->prev)->type != APPEND)
-		{
+		if (ft_pipe_output(next_node, sh))
 			dup2(fds[1], STDOUT_FILENO);
-		}
 		close(fds[1]);
-		ft_exec(((t_exec *)node)->args, sh);
+		ft_exec((t_exec *)node, sh);
 	}
 	return (pid);
 }
@@ -54,9 +51,10 @@ pid_t	ft_child_process(int *fds, t_shell *sh, void *node, void *next_node)
 /**
  * @brief Manages the parent process in a pipeline or command execution.
  *
- * Handles signals, waits for the child process to finish, and updates the
- * exit status. Manages file descriptors for pipeline continuation or restores
- * the original file descriptors if the pipeline ends.
+ * Records the stage in the job table. Manages file descriptors for pipeline
+ * continuation or, if the pipeline ends, restores the original file
+ * descriptors (so that no pipe end is kept open by the shell) and then waits
+ * for all of its stages and updates the exit status.
  *
  * @param curr_fds The current file descriptors for the pipe.
  * @param sh The shell structure containing the execution state and environment
@@ -65,21 +63,15 @@ pid_t	ft_child_process(int *fds, t_shell *sh, void *node, void *next_node)
  */
 void	ft_parent_process(int *curr_fds, t_shell *sh, void *node, pid_t pid)
 {
-	int		status;
-
 	sh->error_fd = 0;
+	ft_job_add(sh, pid);
 	if (!node)
 	{
 		close_fds(curr_fds);
-		if (pid != -1 && waitpid(pid, &status, 0) != -1)
-		{
-			if (WIFEXITED(status))
-				ft_exit_status(WEXITSTATUS(status), TRUE, FALSE);
-			else if (WIFSIGNALED(status))
-				ft_exit_status(WTERMSIG(status) + 128, TRUE, FALSE);
+		ft_restore_original_fds(sh);
+		if (ft_job_wait(sh))
 			ft_print_signal();
-		}
-		return (ft_restore_original_fds(sh));
+		return ;
 	}
 	if (node)
 		dup2(curr_fds[0], STDIN_FILENO);
@@ -95,8 +87,9 @@ void	ft_parent_process(int *curr_fds, t_shell *sh, void *node, pid_t pid)
  *
  * This function creates a pipe, executes the command in a child process, and 
  * manages the file descriptors. If `sh->error_fd` is 0, it creates the pipe 
- * and calls `ft_child_process` to execute the command in the child process.
- * Then, it calls `ft_parent_process` to manage the parent process.
+ * and tries `ft_spawn_command` first, falling back to `ft_child_process` to
+ * execute the command in a forked child process. Then, it calls
+ * `ft_parent_process` to manage the parent process.
  *
  * @param node The current node of the command list.
  * @param next_node The next node of the command list.
@@ -110,9 +103,16 @@ void	ft_launcher_exec(void *node, void *next_node, int *fds, t_shell *sh)
 	pid = -1;
 	if (sh->error_fd == 0)
 	{
+		if (sh->tail && !next_node)
+			ft_exec_tail(node, sh);
 		if (pipe(fds) == -1)
 			return (ft_exit_status(1, TRUE, FALSE), ft_stderror(TRUE, ""));
-		pid = ft_child_process(fds, sh, node, next_node);
+		pid = ft_spawn_command(fds, sh, node, next_node);
+		if (pid == 0)
+		{
+			ft_hash_prefetch((t_exec *)node, sh);
+			pid = ft_child_process(fds, sh, node, next_node);
+		}
 	}
 	ft_parent_process(fds, sh, next_node, pid);
 }
@@ -131,7 +131,7 @@ void	ft_launcher_exec(void *node, void *next_node, int *fds, t_shell *sh)
  */
 void	ft_launcher(t_node *node, t_node *next_node, int *curr_fds, t_shell *sh)
 {
-	ft_save_original_fds(sh);
+	ft_save_original_fds(sh, ft_redirects_stdio(node));
 	if (!node)
 		return ;
 	else if (((t_node *)node)->type == PIPE)
@@ -165,6 +165,9 @@ void	ft_launcher(t_node *node, t_node *next_node, int *curr_fds, t_shell *sh)
  * handling heredoc inputs, and managing command execution based on logical 
  * operators (`AND` and `OR`). It initializes signal handling, processes 
  * single commands, and recursively handles branching execution paths.
+ * The commands of each level are launched by `ft_launcher_tail`, and their
+ * statuses published in `PIPESTATUS` by `ft_job_finish`. A list that ends
+ * with `&` is handed to `ft_background` instead.
  *
  * @param tree The root of the syntax tree to process and execute.
  * @param sh The shell structure containing the execution state and context.
@@ -182,16 +185,18 @@ void	ft_launcher_manager(void *tree, t_shell *sh)
 		ft_heredoc_manager(curr_root, sh);
 		sh->search_heredoc = TRUE;
 	}
+	if (ft_background(curr_root, sh))
+		return ;
 	if (sh->run == TRUE && !ft_single_command(curr_root, sh))
-		ft_launcher(curr_root->left, NULL, NULL, sh);
-	if (curr_root->right)
-	{
-		curr_root = curr_root->right;
-		if (curr_root->type == AND && ft_exit_status(0, FALSE, FALSE) == 0)
-			ft_launcher_manager(curr_root, sh);
-		else if (curr_root->type == OR && ft_exit_status(0, FALSE, FALSE) != 0)
-			ft_launcher_manager(curr_root, sh);
-		else
-			ft_launcher_manager(curr_root->right, sh);
-	}
+		ft_launcher_tail(curr_root, sh);
+	ft_job_finish(sh);
+	ft_procsub_reap(sh);
+	if (!curr_root->right)
+		return ;
+	curr_root = curr_root->right;
+	if ((curr_root->type == AND && ft_exit_status(0, FALSE, FALSE) == 0)
+		|| (curr_root->type == OR && ft_exit_status(0, FALSE, FALSE) != 0))
+		ft_launcher_manager(curr_root, sh);
+	else
+		ft_launcher_manager(curr_root->right, sh);
 }
@@ -17,13 +17,18 @@
  *
  * This function manages the execution of a specific subroot node within the
  * syntax tree. It coordinates the launcher, cleans up resources in the child
- * process, and updates the shell's exit status accordingly.
+ * process, and updates the shell's exit status accordingly. The process
+ * exits right after the tree, so its last command runs in tail position, and
+ * starts with an empty job table, since the stages it inherited belong to
+ * its parent.
  *
  * @param node The syntax tree node to be executed.
  * @param sh The shell structure containing the execution context and state.
  */
 void	ft_exec_subroot(void *node, t_shell *sh)
 {
+	sh->tail = TRUE;
+	ft_lstclear(&sh->stages, free);
 	ft_launcher_manager(node, sh);
 	ft_child_cleaner(sh, NULL, 0);
 	ft_exit_status(0, FALSE, TRUE);
@@ -61,11 +66,8 @@ pid_t	ft_child_process_subroot(int *fds, t_shell *sh, void *node, \
 	{
 		close_original_fds(sh);
 		close(fds[0]);
-		if (next_node != NULL && (sh->prev && ((t_redir *)sh->prev)->type
-				!= OUTFILE) && ((t_redir *)sh->prev)->type != APPEND)
-		{
+		if (ft_pipe_output(next_node, sh))
 			dup2(fds[1], STDOUT_FILENO);
-		}
 		close(fds[1]);
 		sh->fds_saved = 0;
 		ft_exec_subroot(node, sh);
@@ -77,34 +79,29 @@ pid_t	ft_child_process_subroot(int *fds, t_shell *sh, void *node, \
  * @brief Manages the parent process after forking a subroot execution.
  *
  * This function handles the necessary operations in the parent process after
- * a subroot node has been executed in a child process. It manages signal
- * handling, waits for the child process to complete, updates the exit status,
- * and restores the original file descriptors. For additional nodes, it sets
+ * a subroot node has been executed in a child process. It records the stage
+ * in the job table and, at the end of the pipeline, restores the original
+ * file descriptors, then waits for all of its stages and updates the exit
+ * status. For additional nodes, it sets
  * up redirection and launches the next part of the syntax tree.
  *
  * @param fds An array of file descriptors used for communication and
  *            redirection.
  * @param sh The shell structure containing the execution context and state.
  * @param node The syntax tree node to process after the subroot execution.
- * @param pid The process ID of the child process to wait for.
+ * @param pid The process ID of the child process to record.
  */
 void	ft_parent_process_subroot(int *fds, t_shell *sh, void *node, pid_t pid)
 {
-	int		status;
-
 	sh->error_fd = 0;
+	ft_job_add(sh, pid);
 	if (!node)
 	{
 		close_fds(fds);
-		if (pid != -1 && waitpid(pid, &status, 0) != -1)
-		{
-			if (WIFEXITED(status))
-				ft_exit_status(WEXITSTATUS(status), TRUE, FALSE);
-			else if (WIFSIGNALED(status))
-				ft_exit_status(WTERMSIG(status) + 128, TRUE, FALSE);
+		ft_restore_original_fds(sh);
+		if (ft_job_wait(sh))
 			ft_print_signal();
-		}
-		return (ft_restore_original_fds(sh));
+		return ;
 	}
 	if (node)
 		dup2(fds[0], STDIN_FILENO);
@@ -138,6 +135,8 @@ void	ft_launcher_subroot(void *node, void *next_node, t_shell *sh)
 	pid = -1;
 	if (sh->error_fd == 0)
 	{
+		if (sh->tail && !next_node)
+			ft_exec_tail(node, sh);
 		if (pipe(new_fds) == -1)
 			return (ft_exit_status(1, TRUE, FALSE), ft_stderror(TRUE, ""));
 		pid = ft_child_process_subroot(new_fds, sh, node, next_node);
@@ -65,35 +65,45 @@ void	close_fds(int *fds)
 }
 
 /**
- * @brief Saves the original file descriptors for stdin and stdout.
+ * @brief Saves the original standard file descriptors about to be replaced.
  *
- * Duplicates the original stdin and stdout file descriptors and stores them
- * in the shell structure if they haven't been saved already. Handles errors
- * and updates the shell state.
+ * Duplicates the streams selected by `mask` (see `ft_redirects_stdio` and
+ * `ft_redir_plan`) and stores them in the shell structure, unless they
+ * were saved already. The copies are close-on-exec and numbered from
+ * `SAVED_FD_MIN`, so executed commands never inherit them and they do not
+ * take the low numbers redirections and pipes use. Handles errors and
+ * updates the shell state.
  *
  * @param sh The shell structure containing the file descriptors and state.
+ * @param mask The `SAVE_` flags of the streams to save.
  */
-void	ft_save_original_fds(t_shell *sh)
+void	ft_save_original_fds(t_shell *sh, int mask)
 {
-	if (sh->fds_saved == 0)
+	if (sh->fds_saved != 0 || !mask)
+		return ;
+	if (mask & SAVE_STDIN)
+		sh->stdin_ = fcntl(STDIN_FILENO, F_DUPFD_CLOEXEC, SAVED_FD_MIN);
+	if (mask & SAVE_STDOUT)
+		sh->stdout_ = fcntl(STDOUT_FILENO, F_DUPFD_CLOEXEC, SAVED_FD_MIN);
+	if (mask & SAVE_STDERR)
+		sh->stderr_ = fcntl(STDERR_FILENO, F_DUPFD_CLOEXEC, SAVED_FD_MIN);
+	if (((mask & SAVE_STDIN) && sh->stdin_ == -1)
+		|| ((mask & SAVE_STDOUT) && sh->stdout_ == -1)
+		|| ((mask & SAVE_STDERR) && sh->stderr_ == -1))
 	{
-		sh->stdin_ = dup(STDIN_FILENO);
-		sh->stdout_ = dup(STDOUT_FILENO);
-		sh->stderr_ = dup(STDERR_FILENO);
-		if (sh->stdin_ == -1 || sh->stdout_ == -1 || sh->stderr_ == -1)
-		{
-			ft_stderror(TRUE, "Error saving original FDs");
-			ft_exit_status(1, TRUE, TRUE);
-		}
-		sh->fds_saved = 1;
+		ft_stderror(TRUE, "Error saving original FDs");
+		ft_exit_status(1, TRUE, TRUE);
 	}
+	sh->fds_saved = 1;
 }
 
 /**
- * @brief Restores the original file descriptors for stdin and stdout.
+ * @brief Restores the original standard file descriptors that were saved.
  *
- * Duplicates the original stdin and stdout file descriptors back to their
- * standard locations. Handles errors and closes the saved file descriptors.
+ * Duplicates the saved file descriptors back to their standard locations;
+ * streams that were not saved are left alone. Handles errors and closes the
+ * saved file descriptors, marking them as closed so that a later cleanup
+ * cannot close a descriptor number that has since been reused.
  *
  * @param sh The shell structure containing the saved file descriptors.
  */
@@ -101,20 +111,14 @@ void	ft_restore_original_fds(t_shell *sh)
 {
 	if (sh->fds_saved == 1)
 	{
-		if (dup2(sh->stdin_, STDIN_FILENO) == -1)
+		if (sh->stdin_ != -1 && dup2(sh->stdin_, STDIN_FILENO) == -1)
 			ft_stderror(TRUE, "Error restoring original STDIN");
-		if (sh->stdin_ != -1)
-			close(sh->stdin_);
-		if (dup2(sh->stdout_, STDOUT_FILENO) == -1)
+		if (sh->stdout_ != -1 && dup2(sh->stdout_, STDOUT_FILENO) == -1)
 			ft_stderror(TRUE, "Error restoring original STDOUT");
-		if (sh->stdout_ != -1)
-			close(sh->stdout_);
-		if (dup2(sh->stderr_, STDERR_FILENO) == -1)
+		if (sh->stderr_ != -1 && dup2(sh->stderr_, STDERR_FILENO) == -1)
 			ft_stderror(TRUE, "Error restoring original STDERR");
-		if (sh->stderr_ != -1)
-			close(sh->stderr_);
-		while (waitpid(-1, NULL, 0) > 0)
-			;
+		close_original_fds(sh);
+		ft_procsub_close(sh);
 	}
 	sh->fds_saved = 0;
 }
@@ -0,0 +1,149 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_path_hash_bonus.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: joneves- <joneves-@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by joneves-          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by joneves-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell_bonus.h"
+
+/**
+ * @brief Searches the directories of a PATH value for an executable.
+ *
+ * The directories are walked in place, without splitting the PATH value,
+ * and every candidate is built in a single stack buffer. A candidate costs
+ * one `stat`, plus one `access` if it exists.
+ *
+ * @param name The command name.
+ * @param path The PATH value (may be NULL).
+ * @return The absolute path of the executable, or NULL if it is not found.
+ */
+char	*ft_path_search(char *name, char *path)
+{
+	char		buf[PATH_MAX];
+	struct stat	file;
+	size_t		dir;
+	size_t		len;
+
+	len = ft_strlen(name);
+	while (path && *path)
+	{
+		dir = 0;
+		while (path[dir] && path[dir] != ':')
+			dir++;
+		if (dir && dir + len + 2 <= PATH_MAX)
+		{
+			ft_memcpy(buf, path, dir);
+			buf[dir] = '/';
+			ft_memcpy(buf + dir + 1, name, len + 1);
+			if (stat(buf, &file) == 0 && !S_ISDIR(file.st_mode)
+				&& access(buf, X_OK) == 0)
+				return (ft_strdup(buf));
+		}
+		path += dir;
+		if (*path == ':')
+			path++;
+	}
+	return (NULL);
+}
+
+/**
+ * @brief Looks a command name up in the hash table, searching PATH on a miss.
+ *
+ * The table is emptied first if `PATH` was exported, changed or unset since
+ * it was filled. A name resolved ahead of time by `ft_hash_warm` is taken
+ * from the warm table instead of searching PATH again. Names that are not
+ * found are remembered too (with an empty path), so a missing command is not
+ * searched for again.
+ *
+ * @param name The command name (without a `/`).
+ * @param sh A pointer to the shell structure holding the hash table.
+ * @return The use counter of the entry, or NULL if an allocation fails.
+ */
+size_t	*ft_hash_lookup(char *name, t_shell *sh)
+{
+	char	*path;
+	char	*found;
+
+	path = ft_env_value(sh->global, "PATH");
+	ft_hash_sync(path, sh);
+	if (!ft_hmap_get(&sh->hash, name))
+	{
+		found = ft_hmap_get(&sh->warm, name);
+		if (found)
+			found = ft_strdup(found);
+		else
+			found = ft_path_search(name, path);
+		if (!found)
+			found = ft_strdup("");
+		if (!found || ft_hmap_set(&sh->hash, name, found) == -1)
+			return (free(found), NULL);
+		free(found);
+		ft_hmap_del(&sh->warm, name);
+	}
+	return (ft_hmap_hits(&sh->hash, name));
+}
+
+/**
+ * @brief Resolves a command name in a child process.
+ *
+ * The hash table inherited from the shell is used when the environment of
+ * the command has the PATH value the table was filled for; otherwise (e.g.
+ * `PATH=/bin cmd`) the PATH of the environment is searched.
+ *
+ * @param name The command name (without a `/`).
+ * @param envp The environment the command will run with.
+ * @param sh A pointer to the shell structure holding the hash table.
+ * @return The newly allocated path of the command, or NULL if not found.
+ */
+char	*ft_hash_find(char *name, char **envp, t_shell *sh)
+{
+	char	*path;
+	char	*hit;
+
+	path = ft_env_value(envp, "PATH");
+	if (ft_hash_same(path, sh))
+	{
+		hit = ft_hmap_get(&sh->hash, name);
+		if (hit && !*hit)
+			return (NULL);
+		if (hit)
+			return (ft_strdup(hit));
+	}
+	return (ft_path_search(name, path));
+}
+
+/**
+ * @brief Fills the hash table for a command before its process is forked.
+ *
+ * Lookups done in a child are lost when it exits, so the shell resolves the
+ * command name itself when it is already known: a literal word, or a word
+ * expanded by the shell beforehand. Builtins and names with a `/` are never
+ * hashed.
+ *
+ * @param exec The executable node about to be launched.
+ * @param sh A pointer to the shell structure holding the hash table.
+ */
+void	ft_hash_prefetch(t_exec *exec, t_shell *sh)
+{
+	t_token	*tkn;
+	size_t	*hits;
+
+	if (!exec->args || !*exec->args)
+		return ;
+	tkn = (t_token *)(*exec->args)->content;
+	if (!exec->expanded && (tkn->expand || tkn->state || tkn->brace
+			|| tkn->wildcard))
+		return ;
+	if (!*tkn->value || ft_strchr(tkn->value, '/')
+		|| ft_isbuiltin(&tkn->value, sh))
+		return ;
+	hits = ft_hash_lookup(tkn->value, sh);
+	if (hits)
+		(*hits)++;
+}
@@ -0,0 +1,81 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_path_hash_utils_bonus.c                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: joneves- <joneves-@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by joneves-          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by joneves-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell_bonus.h"
+
+/**
+ * @brief Tells whether the hash table was filled for a given PATH value.
+ *
+ * @param path The PATH value (may be NULL).
+ * @param sh A pointer to the shell structure holding the hash table.
+ * @return true if the table belongs to that PATH value.
+ */
+bool	ft_hash_same(char *path, t_shell *sh)
+{
+	if (!path || !sh->hash_path)
+		return (!path && !sh->hash_path);
+	return (!ft_strcmp(path, sh->hash_path));
+}
+
+/**
+ * @brief Forgets every remembered command, warmed ones included.
+ *
+ * @param sh A pointer to the shell structure holding the hash tables.
+ */
+void	ft_hash_clear(t_shell *sh)
+{
+	ft_hmap_clear(&sh->hash);
+	ft_hmap_clear(&sh->warm);
+}
+
+/**
+ * @brief Empties the hash tables if they were filled for another PATH.
+ *
+ * @param path The current PATH value (may be NULL).
+ * @param sh A pointer to the shell structure holding the hash tables.
+ */
+void	ft_hash_sync(char *path, t_shell *sh)
+{
+	if (ft_hash_same(path, sh))
+		return ;
+	ft_hash_clear(sh);
+	free(sh->hash_path);
+	sh->hash_path = NULL;
+	if (path)
+		sh->hash_path = ft_strdup(path);
+}
+
+/**
+ * @brief Resolves a command name ahead of time, without hashing it.
+ *
+ * Used while a line is being typed: the path found is kept in a separate
+ * warm table, which `ft_hash_lookup` moves into the hash table (and so into
+ * the `hash` listing) only when the command actually runs. Names that are
+ * not found are not remembered, as they are mostly partial words.
+ *
+ * @param name The command name (without a `/`).
+ * @param sh A pointer to the shell structure holding the hash tables.
+ */
+void	ft_hash_warm(char *name, t_shell *sh)
+{
+	char	*path;
+	char	*found;
+
+	path = ft_env_value(sh->global, "PATH");
+	ft_hash_sync(path, sh);
+	if (ft_hmap_get(&sh->hash, name) || ft_hmap_get(&sh->warm, name))
+		return ;
+	found = ft_path_search(name, path);
+	if (found)
+		ft_hmap_set(&sh->warm, name, found);
+	free(found);
+}
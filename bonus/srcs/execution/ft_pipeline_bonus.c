@@ -0,0 +1,184 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_pipeline_bonus.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: joneves- <joneves-@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by joneves-          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by joneves-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell_bonus.h"
+
+/**
+ * @brief Spawns a pipeline stage from a plan prepared in the shell.
+ *
+ * The stage's pipe ends are placed on its standard input and output by the
+ * file actions, in the new process only. Every pipe is close-on-exec, so
+ * no other end needs an action.
+ *
+ * @param exec The command node of the stage.
+ * @param fds The stage's standard input and output, or -1 to keep the
+ *        shell's own stream.
+ * @param sh A pointer to the shell structure.
+ * @return The process ID, -1 if the command failed without a process, or
+ *         0 if the command has no plan.
+ */
+static pid_t	ft_pipeline_spawn(t_exec *exec, int *fds, t_shell *sh)
+{
+	posix_spawn_file_actions_t	fa;
+	t_plan						plan;
+	pid_t						pid;
+	int							err;
+
+	if (!ft_plan_build(&plan, exec, sh))
+		return (0);
+	pid = -1;
+	plan.io[0] = fds[0];
+	plan.io[1] = fds[1];
+	err = posix_spawn_file_actions_init(&fa);
+	if (err)
+		return (ft_plan_free(&plan), ft_error_malloc("file actions"), -1);
+	if (fds[0] != -1)
+		err = posix_spawn_file_actions_adddup2(&fa, fds[0], STDIN_FILENO);
+	if (!err && fds[1] != -1)
+		err = posix_spawn_file_actions_adddup2(&fa, fds[1], STDOUT_FILENO);
+	if (!err)
+		pid = ft_spawn_run(&plan, &fa);
+	else
+		ft_error_malloc("file actions");
+	posix_spawn_file_actions_destroy(&fa);
+	ft_plan_free(&plan);
+	return (pid);
+}
+
+/**
+ * @brief Runs a pipeline stage in a forked child.
+ *
+ * The child takes its pipe ends as its standard streams and closes the
+ * pipes it inherited, since a builtin or a subshell does not `execve` and
+ * would otherwise keep its neighbours from seeing end-of-file or SIGPIPE.
+ * This never returns.
+ *
+ * @param node The command or subshell node of the stage.
+ * @param fds The stage's standard input and output, then the read end of
+ *        the next pipe.
+ * @param sh A pointer to the shell structure.
+ */
+static void	ft_pipeline_child(t_node *node, int *fds, t_shell *sh)
+{
+	close_original_fds(sh);
+	sh->fds_saved = 0;
+	if (fds[0] != -1)
+		dup2(fds[0], STDIN_FILENO);
+	if (fds[1] != -1)
+		dup2(fds[1], STDOUT_FILENO);
+	close_fds(fds);
+	if (fds[2] != -1)
+		close(fds[2]);
+	if (node->type == SUB_ROOT)
+		ft_exec_subroot(node, sh);
+	ft_exec((t_exec *)node, sh);
+}
+
+/**
+ * @brief Starts a pipeline stage.
+ *
+ * External commands are spawned from a plan; builtins, subshells and
+ * commands whose expansion must happen in the child are forked.
+ *
+ * @param node The command or subshell node of the stage.
+ * @param fds The stage's standard input and output, then the read end of
+ *        the next pipe.
+ * @param sh A pointer to the shell structure.
+ * @return The process ID, or -1 if no process was started.
+ */
+static pid_t	ft_pipeline_stage(t_node *node, int *fds, t_shell *sh)
+{
+	pid_t	pid;
+
+	ft_signal(CHILD_);
+	pid = 0;
+	if (node->type == EXEC)
+		pid = ft_pipeline_spawn((t_exec *)node, fds, sh);
+	if (pid != 0)
+		return (pid);
+	if (node->type == EXEC)
+		ft_hash_prefetch((t_exec *)node, sh);
+	pid = fork();
+	if (pid == -1)
+	{
+		ft_stderror(TRUE, "");
+		ft_exit_status(1, TRUE, FALSE);
+	}
+	if (pid == 0)
+		ft_pipeline_child(node, fds, sh);
+	return (pid);
+}
+
+/**
+ * @brief Gives up a pipeline whose next pipe could not be created.
+ *
+ * The read end left for the next stage is closed and the stages already
+ * started are waited for, so no zombie or job entry is left behind.
+ *
+ * @param fd The read end of the last pipe created, or -1.
+ * @param sh A pointer to the shell structure.
+ * @return Always `true`: the pipeline was handled.
+ */
+static bool	ft_pipeline_abort(int fd, t_shell *sh)
+{
+	ft_stderror(TRUE, "");
+	if (fd != -1)
+		close(fd);
+	if (ft_job_wait(sh))
+		ft_print_signal();
+	ft_exit_status(1, TRUE, FALSE);
+	return (true);
+}
+
+/**
+ * @brief Launches a pipeline without touching the shell's own streams.
+ *
+ * Each stage receives its pipe ends directly, created close-on-exec with
+ * `pipe2`, and the stages are started back to back before any of them is
+ * waited for. The shell's descriptors 0 to 2 are never rewired, so nothing
+ * has to be saved or restored. A pipe is created just before the stage
+ * that writes to it, and the shell closes its ends as soon as both stages
+ * have them: every process is then started with at most three pipe ends
+ * open in the shell, instead of all of them. Pipelines with redirections
+ * keep the regular launcher (see `ft_pipeline_simple`).
+ *
+ * @param node The first `PIPE` node of the pipeline.
+ * @param sh A pointer to the shell structure.
+ * @return `true` if the pipeline was run, `false` if it does not qualify.
+ */
+bool	ft_pipeline(t_node *node, t_shell *sh)
+{
+	int	fds[3];
+	int	next[2];
+
+	if (!ft_pipeline_simple(node) || sh->error_fd != 0)
+		return (false);
+	fds[0] = -1;
+	while (node)
+	{
+		next[0] = -1;
+		next[1] = -1;
+		if (node->right && pipe2(next, O_CLOEXEC) == -1)
+			return (ft_pipeline_abort(fds[0], sh));
+		fds[1] = next[1];
+		fds[2] = next[0];
+		sh->prev = node;
+		ft_issubroot(node, sh);
+		ft_job_add(sh, ft_pipeline_stage(node->left, fds, sh));
+		close_fds(fds);
+		fds[0] = fds[2];
+		node = node->right;
+	}
+	if (ft_job_wait(sh))
+		ft_print_signal();
+	return (true);
+}
@@ -0,0 +1,38 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_pipeline_utils_bonus.c                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: joneves- <joneves-@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by joneves-          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by joneves-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell_bonus.h"
+
+/**
+ * @brief Checks whether `ft_pipeline` can launch a pipeline.
+ *
+ * Only pipelines of two or more stages that are each a plain command or a
+ * subshell qualify: redirections are applied in the shell itself, in
+ * order, together with the here-documents they consume.
+ *
+ * @param node The first `PIPE` node of the pipeline, or NULL.
+ * @return `true` if the pipeline qualifies, otherwise `false`.
+ */
+bool	ft_pipeline_simple(t_node *node)
+{
+	int	size;
+
+	size = 0;
+	while (node && node->type == PIPE && node->left
+		&& (((t_node *)node->left)->type == EXEC
+			|| ((t_node *)node->left)->type == SUB_ROOT))
+	{
+		size++;
+		node = node->right;
+	}
+	return (!node && size > 1);
+}
@@ -0,0 +1,148 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_prefix_env_bonus.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: joneves- <joneves-@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by joneves-          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by joneves-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell_bonus.h"
+
+/**
+ * @brief Finds the entry of a `KEY=value` vector that has the key of a word.
+ *
+ * @param vector The NULL-terminated vector to search (may be NULL).
+ * @param word A `KEY=value` word.
+ * @return The index of the entry with the same key, or -1 if there is none.
+ */
+int	ft_overlay_index(char **vector, char *word)
+{
+	size_t	len;
+	int		i;
+
+	len = ft_strlen(word);
+	if (ft_strchr(word, '='))
+		len = ft_strchr(word, '=') - word;
+	i = 0;
+	while (vector && vector[i])
+	{
+		if (!ft_strncmp(vector[i], word, len)
+			&& (vector[i][len] == '=' || !vector[i][len]))
+			return (i);
+		i++;
+	}
+	return (-1);
+}
+
+/**
+ * @brief Gets the value of a variable in a `KEY=value` vector.
+ *
+ * @param env The NULL-terminated vector to search (may be NULL).
+ * @param key The name of the variable.
+ * @return A pointer to the value inside the vector, or NULL if not set.
+ */
+char	*ft_env_value(char **env, char *key)
+{
+	int	i;
+
+	i = ft_overlay_index(env, key);
+	if (i == -1 || !ft_strchr(env[i], '='))
+		return (NULL);
+	return (ft_strchr(env[i], '=') + 1);
+}
+
+/**
+ * @brief Builds the environment of a command from the exported environment
+ *        and its prefix assignments.
+ *
+ * The result only holds pointers into `env` and `words`: no string is copied,
+ * and only the vector itself must be freed. Entries overridden by a word are
+ * left out, and when a key is assigned several times the last word wins.
+ *
+ * @param env The exported environment (may be NULL).
+ * @param words The `KEY=value` assignments (may be NULL).
+ * @return The overlaid environment, or NULL if the allocation fails.
+ */
+char	**ft_overlay_env(char **env, char **words)
+{
+	char	**envp;
+	int		n;
+	int		i;
+
+	envp = (char **)malloc(sizeof(char *)
+			* (ft_argslen(env) + ft_argslen(words) + 1));
+	if (!envp)
+		return (ft_error_malloc("envp"), NULL);
+	n = 0;
+	i = -1;
+	while (env && env[++i])
+		if (ft_overlay_index(words, env[i]) == -1)
+			envp[n++] = env[i];
+	i = -1;
+	while (words && words[++i])
+		if (ft_overlay_index(words + i + 1, words[i]) == -1)
+			envp[n++] = words[i];
+	envp[n] = NULL;
+	return (envp);
+}
+
+/**
+ * @brief Resolves a `KEY+=value` prefix assignment into `KEY=old+value`.
+ *
+ * @param word The expanded assignment word.
+ * @param sh A pointer to the shell structure holding the variables.
+ * @return A newly allocated `KEY=value` string, or NULL on error.
+ */
+static char	*ft_assign_append(char *word, t_shell *sh)
+{
+	char	*plus;
+	char	*value;
+	char	*joined;
+
+	plus = ft_strchr(word, '+');
+	value = ft_getvar(word, plus - word, sh);
+	if (!value)
+		value = "";
+	joined = merge(ft_substr(word, 0, plus - word), "=");
+	if (joined)
+		joined = merge(merge(joined, value), plus + 2);
+	return (joined);
+}
+
+/**
+ * @brief Expands the prefix assignments of a command into `KEY=value` words.
+ *
+ * The assignment tokens are expanded like any other word, but never split
+ * into fields.
+ *
+ * @param assigns The list of prefix assignment tokens (may be NULL).
+ * @param sh A pointer to the shell structure used for expansions.
+ * @return A NULL-terminated vector of `KEY=value` words, or NULL if the
+ *         command has no prefix assignments.
+ */
+char	**ft_assign_words(t_list **assigns, t_shell *sh)
+{
+	t_argv	words;
+	t_list	*curr;
+	t_token	*tkn;
+
+	if (!assigns || !*assigns
+		|| !ft_argv_init(&words, ft_lstsize(*assigns) + 1))
+		return (NULL);
+	ft_process_token_list(assigns, sh);
+	curr = *assigns;
+	while (curr)
+	{
+		tkn = (t_token *)curr->content;
+		if (tkn->type == EXPORT_AP)
+			ft_argv_push(&words, ft_assign_append(tkn->value, sh));
+		else
+			ft_argv_push(&words, ft_strdup(tkn->value));
+		curr = curr->next;
+	}
+	return (words.v);
+}
@@ -0,0 +1,173 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_prefix_env_utils_bonus.c                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: joneves- <joneves-@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by joneves-          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by joneves-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell_bonus.h"
+
+/**
+ * @brief Drops the prefix assignments from the environment after a builtin.
+ *
+ * Every key assigned by a prefix gets back the value it had before the
+ * builtin ran (or is removed if it was not set), even when the builtin
+ * unset it. A key the builtin assigned itself (`X=1 export X=2`), seen as a
+ * value that no longer matches the prefix, keeps the builtin's value, and so
+ * does any other change made by the builtin (e.g. `cd` updating `PWD`).
+ *
+ * @param saved The exported environment from before the builtin.
+ * @param words The prefix assignments.
+ * @param sh A pointer to the shell structure holding the environment.
+ */
+static void	ft_prefix_restore(char **saved, char **words, t_shell *sh)
+{
+	int		i;
+	int		j;
+	int		k;
+
+	i = -1;
+	while (words[++i])
+	{
+		j = ft_overlay_index(sh->global, words[i]);
+		k = ft_overlay_index(saved, words[i]);
+		if (ft_overlay_index(words + i + 1, words[i]) != -1
+			|| (j != -1 && ft_strcmp(sh->global[j], words[i]) != 0))
+			continue ;
+		if (j == -1 && k != -1)
+			add_var(saved[k], ft_argslen(sh->global), &sh->global);
+		if (j == -1)
+			continue ;
+		free(sh->global[j]);
+		if (k != -1)
+			sh->global[j] = ft_strdup(saved[k]);
+		else
+			ft_memmove(sh->global + j, sh->global + j + 1,
+				sizeof(char *) * (ft_argslen(sh->global + j + 1) + 1));
+	}
+	ft_free_vector(saved);
+}
+
+/**
+ * @brief Sets again the shell variables that a builtin with prefix
+ *        assignments removed.
+ *
+ * `Y=1 unset Y` only drops the assignment: a variable `Y` that was set, but
+ * not exported, before the builtin ran is still set afterwards.
+ *
+ * @param saved The shell variables from before the builtin, or NULL.
+ * @param words The prefix assignments.
+ * @param sh A pointer to the shell structure holding the variables.
+ */
+static void	ft_prefix_restore_local(char **saved, char **words, t_shell *sh)
+{
+	int	i;
+	int	k;
+
+	i = -1;
+	while (saved && words[++i])
+	{
+		k = ft_overlay_index(saved, words[i]);
+		if (k != -1 && ft_overlay_index(sh->local, words[i]) == -1
+			&& ft_overlay_index(sh->global, words[i]) == -1)
+			add_var(saved[k], ft_argslen(sh->local), &sh->local);
+	}
+	ft_free_vector(saved);
+}
+
+/**
+ * @brief Runs a builtin with its prefix assignments in the environment.
+ *
+ * The builtin runs on a private copy of the exported environment holding
+ * the assignments, which are dropped again once it returns, along with
+ * any variable the builtin removed only through them.
+ *
+ * @param args The arguments of the builtin.
+ * @param words The prefix assignments (may be NULL).
+ * @param sh A pointer to the shell structure holding the environment.
+ */
+void	ft_prefix_builtin(char **args, char **words, t_shell *sh)
+{
+	char	**saved;
+	char	**envp;
+	char	**local;
+
+	if (!words || !*words)
+		return (ft_exec_builtin(args, sh));
+	envp = ft_overlay_env(sh->global, words);
+	if (!envp)
+		return (ft_exec_builtin(args, sh));
+	saved = sh->global;
+	sh->global = ft_get_my_envp(envp);
+	free(envp);
+	if (!sh->global)
+	{
+		sh->global = saved;
+		return (ft_error_malloc("envp"), ft_exec_builtin(args, sh));
+	}
+	local = ft_get_my_envp(sh->local);
+	ft_exec_builtin(args, sh);
+	ft_prefix_restore(saved, words, sh);
+	ft_prefix_restore_local(local, words, sh);
+}
+
+/**
+ * @brief Tells whether the arguments are `env [VAR=value]... command`.
+ *
+ * @param args The arguments of the command.
+ * @return The index of the command run by `env`, or 0 if the arguments do
+ *         not run a command through `env`.
+ */
+int	ft_env_command(char **args)
+{
+	int	i;
+
+	if (!args || !args[0] || ft_strcmp(args[0], "env"))
+		return (0);
+	i = 1;
+	while (args[i] && ft_strchr(args[i], '=') && args[i][0] != '=')
+		i++;
+	if (!args[i] || args[i][0] == '-')
+		return (0);
+	return (i);
+}
+
+/**
+ * @brief Runs `env VAR=value... command` in the shell itself.
+ *
+ * Instead of executing the `env` program, its assignments are appended to
+ * the prefix assignments of the command and `env` is removed from the
+ * arguments, so the command is executed directly.
+ *
+ * @param args A pointer to the arguments, rewritten in place.
+ * @param words A pointer to the prefix assignments, replaced by a vector
+ *        that also holds the assignments given to `env`.
+ * @return true if the arguments were an `env` command, false otherwise.
+ */
+bool	ft_env_prefix(char ***args, char ***words)
+{
+	t_argv	all;
+	int		cmd;
+	int		i;
+
+	cmd = ft_env_command(*args);
+	if (!cmd || !ft_argv_init(&all, ft_argslen(*words) + cmd))
+		return (false);
+	i = 0;
+	while (*words && (*words)[i])
+		ft_argv_push(&all, (*words)[i++]);
+	i = 0;
+	while (++i < cmd)
+		ft_argv_push(&all, (*args)[i]);
+	free(*words);
+	*words = all.v;
+	free((*args)[0]);
+	ft_memmove(*args, *args + cmd,
+		sizeof(char *) * (ft_argslen(*args + cmd) + 1));
+	return (true);
+}
@@ -0,0 +1,126 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_procsub_bonus.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: joneves- <joneves-@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by joneves-          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by joneves-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell_bonus.h"
+
+/**
+ * @brief Records a process substitution so the launcher can clean it up.
+ *
+ * @param sh The shell structure holding the list of process substitutions.
+ * @param fd The end of the pipe kept open for the command.
+ * @param pid The process ID of the substituted command.
+ * @return `TRUE` on success, `FALSE` if an allocation fails.
+ */
+static int	ft_procsub_track(t_shell *sh, int fd, pid_t pid)
+{
+	t_procsub	*procsub;
+	t_list		*node;
+
+	procsub = (t_procsub *)malloc(sizeof(t_procsub));
+	if (!procsub)
+		return (ft_error_malloc("procsub"), FALSE);
+	procsub->fd = fd;
+	procsub->pid = pid;
+	node = ft_lstnew(procsub);
+	if (!node)
+		return (free(procsub), ft_error_malloc("node"), FALSE);
+	ft_lstadd_back(&sh->procsub, node);
+	sh->last_bg = pid;
+	return (TRUE);
+}
+
+/**
+ * @brief Runs the command of a process substitution in the child process.
+ *
+ * @param body The command text.
+ * @param fds The pipe connecting the command to the shell.
+ * @param input `TRUE` for `<(cmd)`, `FALSE` for `>(cmd)`.
+ * @param sh The shell structure.
+ */
+static void	ft_procsub_child(char *body, int *fds, int input, t_shell *sh)
+{
+	close(fds[!input]);
+	if (input)
+		ft_cmdsub_child(body, fds[1], STDOUT_FILENO, sh);
+	ft_cmdsub_child(body, fds[0], STDIN_FILENO, sh);
+}
+
+/**
+ * @brief Starts the command of a process substitution.
+ *
+ * For `<(cmd)` the child writes into the pipe and the shell keeps the read
+ * end; for `>(cmd)` the child reads from the pipe and the shell keeps the
+ * write end. The kept end is left open (without close-on-exec) so that the
+ * command receiving the `/dev/fd/N` path inherits it.
+ *
+ * @param body The command text, freed by this function.
+ * @param input `TRUE` for `<(cmd)`, `FALSE` for `>(cmd)`.
+ * @param sh The shell structure.
+ * @return The `/dev/fd/N` path of the kept end, or an empty string on error.
+ */
+static char	*ft_procsub_fork(char *body, int input, t_shell *sh)
+{
+	char	*fd_str;
+	char	*path;
+	int		fds[2];
+	pid_t	pid;
+
+	if (pipe(fds) == -1)
+		return (free(body), ft_stderror(TRUE, ""), \
+			ft_exit_status(1, TRUE, FALSE), ft_strdup(""));
+	fflush(stdout);
+	pid = fork();
+	if (pid == -1)
+		return (free(body), close_fds(fds), ft_stderror(TRUE, ""), \
+			ft_exit_status(1, TRUE, FALSE), ft_strdup(""));
+	if (pid == 0)
+		ft_procsub_child(body, fds, input, sh);
+	free(body);
+	close(fds[input]);
+	if (!ft_procsub_track(sh, fds[!input], pid))
+		return (close(fds[!input]), ft_strdup(""));
+	fd_str = ft_itoa(fds[!input]);
+	path = ft_strjoin(PROCSUB_PATH, fd_str);
+	free(fd_str);
+	return (path);
+}
+
+/**
+ * @brief Expands a `<(...)` or `>(...)` process substitution.
+ *
+ * The command runs concurrently with the command line that uses it, connected
+ * through a pipe, and the substitution expands to the `/dev/fd/N` path of the
+ * shell's end of that pipe. The pipe end and the child are tracked in the
+ * shell structure until the command line has been launched.
+ *
+ * @param value The string being expanded.
+ * @param i Pointer to the index of the `(` in `value`, right after the `<` or
+ *        `>`. It is updated to point past the closing parenthesis.
+ * @param sh The shell structure.
+ * @return The newly allocated expansion.
+ */
+char	*ft_expand_procsub(char *value, int *i, t_shell *sh)
+{
+	char	*body;
+	int		input;
+	int		end;
+
+	input = (value[*i - 1] == '<');
+	end = ft_find_next_brace(value, *i - 1);
+	if (end == -1)
+		return (ft_substr(value, *i - 1, 1));
+	body = ft_substr(value, *i + 1, end - *i - 1);
+	*i = end + 1;
+	if (!body)
+		return (ft_error_malloc("body"), ft_strdup(""));
+	return (ft_procsub_fork(body, input, sh));
+}
@@ -0,0 +1,57 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_procsub_utils_bonus.c                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: joneves- <joneves-@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by joneves-          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by joneves-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell_bonus.h"
+
+/**
+ * @brief Closes the shell's ends of the process substitution pipes.
+ *
+ * Called once the command that uses them has been started (it holds its own
+ * copies), so that `>(cmd)` readers see end-of-file and `<(cmd)` writers get
+ * `SIGPIPE` if nobody reads anymore.
+ *
+ * @param sh The shell structure holding the list of process substitutions.
+ */
+void	ft_procsub_close(t_shell *sh)
+{
+	t_list		*curr;
+	t_procsub	*procsub;
+
+	curr = sh->procsub;
+	while (curr)
+	{
+		procsub = (t_procsub *)curr->content;
+		if (procsub->fd != -1)
+			close(procsub->fd);
+		procsub->fd = -1;
+		curr = curr->next;
+	}
+}
+
+/**
+ * @brief Closes the remaining pipe ends and reaps the substituted commands.
+ *
+ * @param sh The shell structure holding the list of process substitutions.
+ */
+void	ft_procsub_reap(t_shell *sh)
+{
+	t_list	*curr;
+
+	ft_procsub_close(sh);
+	curr = sh->procsub;
+	while (curr)
+	{
+		waitpid(((t_procsub *)curr->content)->pid, NULL, 0);
+		curr = curr->next;
+	}
+	ft_lstclear(&sh->procsub, free);
+}
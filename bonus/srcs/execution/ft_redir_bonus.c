@@ -15,10 +15,11 @@
 /**
  * @brief Opens a file with specified type and mode.
  *
- * Handles the opening of a file based on the given type and mode. For input
- * files,it checks for existence and read permissions before attempting to open
- * If the  * file cannot be accessed or opened, it logs an error and sets an
- * exit status.
+ * Handles the opening of a file based on the given type and mode. The file is
+ * opened directly, and `open` itself reports a missing or unreadable file, so
+ * no separate `access` checks are made. If the file cannot be opened, it logs
+ * an error and sets an exit status; a failed input file is replaced by
+ * `/dev/null`.
  *
  * @param type The type of the file, such as INFILE.
  * @param pathname A string representing the path to the file.
@@ -31,27 +32,16 @@ int	ft_open(t_redir *node, char *pathname, int mode, t_shell *sh)
 	int	fd;
 
 	fd = -1;
-	if (node->type == INFILE)
-	{
-		if (access(pathname, F_OK) == -1 || access(pathname, R_OK) == -1)
-		{
-			if (sh->error_fd == 0)
-				ft_stderror(TRUE, "%s: ", pathname);
-			sh->error_fd = -1;
-			ft_exit_status(1, TRUE, FALSE);
-			return (open("/dev/null", O_RDONLY));
-		}
-	}
 	if (sh->error_fd == 0)
 		fd = open(pathname, mode, 0644);
-	if (fd == -1)
-	{
-		if (sh->error_fd == 0)
-			ft_stderror(TRUE, "%s: ", pathname);
-		sh->error_fd = -1;
-		ft_exit_status(1, TRUE, FALSE);
+	if (fd != -1)
 		return (fd);
-	}
+	if (sh->error_fd == 0)
+		ft_stderror(TRUE, "%s: ", pathname);
+	ft_exit_status(1, TRUE, FALSE);
+	if (node->type == INFILE && sh->error_fd == 0)
+		fd = open("/dev/null", O_RDONLY);
+	sh->error_fd = -1;
 	return (fd);
 }
 
@@ -180,7 +170,7 @@ int	ft_redir(t_redir *nd, t_shell *sh)
 	if (nd->type == OUTFILE || nd->type == INFILE || nd->type == APPEND)
 	{
 		target_tmp = ft_strdup(((t_token *)(*nd->target)->content)->value);
-		ft_process_token_list(nd->target, ft_merge_env(sh->global, sh->local));
+		ft_process_token_list(nd->target, sh);
 		if (!*nd->target || ft_is_star(target_tmp))
 			return (ft_stderror(FALSE, "%s: ambiguous redirect", target_tmp), \
 				ft_exit_status(1, TRUE, FALSE), free(target_tmp), FALSE);
@@ -35,3 +35,55 @@ bool	ft_is_star(char *s)
 	else
 		return (false);
 }
+
+/**
+ * @brief Checks whether launching `node` rewires the shell's standard streams.
+ *
+ * Redirections are applied in the shell itself before a command is launched,
+ * and a pipeline moves the shell's standard input from stage to stage, so
+ * both need the original streams saved for restoring afterwards. A lone
+ * command or subshell without redirections leaves them untouched, and skips
+ * the three `dup`, `dup2` and `close` calls of saving and restoring.
+ *
+ * @param node The node about to be launched.
+ * @return The streams to save (`SAVE_ALL`), or 0 if none.
+ */
+int	ft_redirects_stdio(t_node *node)
+{
+	if (!node || ft_is_node_type(node, EXEC) || node->type == SUB_ROOT)
+		return (0);
+	if (node->type == PIPE && !node->right)
+		return (ft_redirects_stdio(node->left));
+	return (SAVE_ALL);
+}
+
+/**
+ * @brief Computes which standard streams the redirections of a command
+ *        replace.
+ *
+ * A builtin run in the shell process only needs the streams its own
+ * redirections replace saved and restored: `cd dir` costs no system call
+ * for them, and `echo hi > file` saves and restores the standard output
+ * alone.
+ *
+ * @param node The first node of the command: its redirections, followed by
+ *        its executable node.
+ * @return The `SAVE_` flags of the streams replaced.
+ */
+int	ft_redir_plan(t_node *node)
+{
+	t_redir	*redir;
+	int		mask;
+
+	mask = 0;
+	redir = (t_redir *)node;
+	while (redir && ft_is_node_type((t_node *)redir, REDIR))
+	{
+		if (redir->type == OUTFILE || redir->type == APPEND)
+			mask |= SAVE_STDOUT;
+		else if (redir->type == INFILE || redir->type == HEREDOC)
+			mask |= SAVE_STDIN;
+		redir = (t_redir *)redir->next;
+	}
+	return (mask);
+}
@@ -0,0 +1,144 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_spawn_bonus.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: joneves- <joneves-@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by joneves-          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by joneves-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell_bonus.h"
+
+/**
+ * @brief Records the descriptor changes done by a spawned command.
+ *
+ * They mirror what a forked child does before running the command: the
+ * pipe's read end is closed, and the pipe's write end becomes the standard
+ * output when needed. The saved standard descriptors are close-on-exec (see
+ * `ft_save_original_fds`), so they need no action.
+ *
+ * @param fa The file actions to fill.
+ * @param fds The pipe created for the command.
+ * @param out Whether the standard output must be the pipe's write end.
+ * @return 0 on success, or an error number.
+ */
+int	ft_spawn_actions(posix_spawn_file_actions_t *fa, int *fds, bool out)
+{
+	int	err;
+
+	err = posix_spawn_file_actions_addclose(fa, fds[0]);
+	if (!err && out)
+		err = posix_spawn_file_actions_adddup2(fa, fds[1], STDOUT_FILENO);
+	if (!err)
+		err = posix_spawn_file_actions_addclose(fa, fds[1]);
+	return (err);
+}
+
+/**
+ * @brief Spawns the program of a plan with the default disposition of the
+ *        signals the shell handles.
+ *
+ * @param plan The execution plan.
+ * @param fa The file actions to apply in the new process.
+ * @param pid Where the process ID is stored.
+ * @return 0 on success, or an error number.
+ */
+static int	ft_spawn_exec(t_plan *plan, posix_spawn_file_actions_t *fa, \
+	pid_t *pid)
+{
+	posix_spawnattr_t	attr;
+	sigset_t			sigs;
+	int					err;
+
+	err = posix_spawnattr_init(&attr);
+	if (err)
+		return (err);
+	sigemptyset(&sigs);
+	sigaddset(&sigs, SIGINT);
+	sigaddset(&sigs, SIGQUIT);
+	sigaddset(&sigs, SIGPIPE);
+	err = posix_spawnattr_setsigdefault(&attr, &sigs);
+	if (!err)
+		err = posix_spawnattr_setflags(&attr, POSIX_SPAWN_SETSIGDEF);
+	if (!err)
+		err = posix_spawn(pid, plan->path, fa, &attr, plan->argv, plan->envp);
+	posix_spawnattr_destroy(&attr);
+	return (err);
+}
+
+/**
+ * @brief Runs an execution plan, reporting its errors like a child would.
+ *
+ * The spawn helper starts the program when the shell runs with one (see
+ * `ft_zygote_spawn`); `fa` is then unused, as the helper's process holds
+ * none of the shell's descriptors.
+ *
+ * @param plan The execution plan.
+ * @param fa The file actions to apply in the new process.
+ * @return The process ID, or -1 if no process was started.
+ */
+pid_t	ft_spawn_run(t_plan *plan, posix_spawn_file_actions_t *fa)
+{
+	pid_t	pid;
+	int		err;
+
+	if (!plan->path)
+		return (ft_stderror(FALSE, "%s: command not found", plan->argv[0]), \
+			ft_exit_status(127, TRUE, FALSE), -1);
+	pid = -1;
+	err = ft_zygote_spawn(plan, &pid);
+	if (err == -1)
+		err = ft_spawn_exec(plan, fa, &pid);
+	if (!err && plan->hits)
+		(*plan->hits)++;
+	if (!err)
+		return (pid);
+	errno = err;
+	return (ft_stderror(TRUE, "%s: ", plan->argv[0]), \
+		ft_exit_status(1, TRUE, FALSE), -1);
+}
+
+/**
+ * @brief Launches an external command from a plan prepared in the shell.
+ *
+ * The command's words, environment and program are resolved before any
+ * process exists (see `ft_plan_build`), then the program is started with
+ * `posix_spawn`. The new process does not copy or touch the shell's
+ * memory: it only applies the file actions and calls `execve`, so its cost
+ * does not grow with the environment or the history. Redirections are
+ * already applied to the shell's descriptors by the launcher, so only the
+ * pipe needs file actions. Commands without a plan are left to
+ * `ft_child_process`.
+ *
+ * @param fds The pipe created for the command.
+ * @param sh A pointer to the shell structure.
+ * @param node The command node.
+ * @param next_node The node that follows the command, or NULL.
+ * @return The process ID, -1 if the command failed without a process, or
+ *         0 if the command has no plan.
+ */
+pid_t	ft_spawn_command(int *fds, t_shell *sh, void *node, void *next_node)
+{
+	posix_spawn_file_actions_t	fa;
+	t_plan						plan;
+	pid_t						pid;
+
+	if (!ft_plan_build(&plan, (t_exec *)node, sh))
+		return (0);
+	ft_signal(CHILD_);
+	pid = -1;
+	if (posix_spawn_file_actions_init(&fa) != 0)
+		return (ft_plan_free(&plan), ft_error_malloc("file actions"), -1);
+	if (ft_pipe_output(next_node, sh))
+		plan.io[1] = fds[1];
+	if (ft_spawn_actions(&fa, fds, plan.io[1] != -1) == 0)
+		pid = ft_spawn_run(&plan, &fa);
+	else
+		ft_error_malloc("file actions");
+	posix_spawn_file_actions_destroy(&fa);
+	ft_plan_free(&plan);
+	return (pid);
+}
@@ -0,0 +1,146 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_spawn_utils_bonus.c                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: joneves- <joneves-@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by joneves-          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by joneves-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell_bonus.h"
+
+/**
+ * @brief Checks if a command's output must be sent into the pipe.
+ *
+ * The output goes to the pipe when another command follows, unless an
+ * output redirection (`>` or `>>`) already applies to this command.
+ *
+ * @param next_node The node that follows the command, or NULL.
+ * @param sh A pointer to the shell structure holding the previous node.
+ * @return true if the standard output must be the pipe's write end.
+ */
+bool	ft_pipe_output(void *next_node, t_shell *sh)
+{
+	return (next_node != NULL && (sh->prev && ((t_redir *)sh->prev)->type
+			!= OUTFILE) && ((t_redir *)sh->prev)->type != APPEND);
+}
+
+/**
+ * @brief Checks if the words of a list can be expanded in the shell itself.
+ *
+ * Expanding in the shell or in a child gives the same words, unless the
+ * expansion has side effects on the shell: command, process and arithmetic
+ * substitutions, `${...}` operators (such as `:=`) and `$RANDOM`. Those
+ * are left to the child, like in a subshell.
+ *
+ * @param list The token list, or NULL.
+ * @return true if no word has such an expansion.
+ */
+static bool	ft_plan_pure(t_list **list)
+{
+	t_list	*curr;
+	char	*s;
+	int		i;
+
+	curr = NULL;
+	if (list)
+		curr = *list;
+	while (curr)
+	{
+		s = ((t_token *)curr->content)->value;
+		i = -1;
+		while (s[++i])
+		{
+			if ((s[i] == '$' && (s[i + 1] == '(' || s[i + 1] == '{'
+						|| !ft_strncmp(&s[i + 1], "RANDOM", 6)))
+				|| ((s[i] == '<' || s[i] == '>') && s[i + 1] == '('))
+				return (false);
+		}
+		curr = curr->next;
+	}
+	return (true);
+}
+
+/**
+ * @brief Resolves the program of an execution plan.
+ *
+ * The PATH hash table is used, and its hit count kept, when the command
+ * runs with the shell's own environment. With prefix assignments, PATH may
+ * differ and is searched only when it does.
+ *
+ * @param plan The plan, whose `argv` and `envp` are set.
+ * @param sh A pointer to the shell structure holding the hash table.
+ */
+static void	ft_plan_path(t_plan *plan, t_shell *sh)
+{
+	if (!plan->words)
+		plan->hits = ft_hash_lookup(plan->argv[0], sh);
+	plan->path = ft_hash_find(plan->argv[0], plan->envp, sh);
+}
+
+/**
+ * @brief Prepares, in the shell, everything a command needs to be executed.
+ *
+ * The plan holds the final argv, the environment (with the prefix
+ * assignments applied) and the resolved program, so that the new process
+ * has nothing left to do but its descriptor changes and `execve`. Only
+ * external commands found by name qualify: builtins, names containing
+ * `/` or existing in the current directory, and words whose expansion
+ * has side effects (see `ft_plan_pure`) keep the regular path. A command
+ * not found in PATH gives a plan without `path`. The caller sets `io` to the
+ * descriptors that replace the command's standard input and output, when
+ * they are not the shell's own (-1).
+ *
+ * @param plan The plan to fill.
+ * @param exec The command node. Its words are expanded and flagged so.
+ * @param sh A pointer to the shell structure.
+ * @return true if the plan is ready, false if the command must be run by
+ *         a forked child.
+ */
+bool	ft_plan_build(t_plan *plan, t_exec *exec, t_shell *sh)
+{
+	char	**argv;
+
+	ft_memset(plan, 0, sizeof(t_plan));
+	if (!exec->args || !*exec->args || !ft_plan_pure(exec->assigns)
+		|| (!exec->expanded && !ft_plan_pure(exec->args)))
+		return (false);
+	if (!exec->expanded)
+		ft_process_token_list(exec->args, sh);
+	exec->expanded = true;
+	argv = tokentostring(exec->args);
+	if (!argv || !argv[0] || !*argv[0] || ft_strchr(argv[0], '/')
+		|| ft_isbuiltin(argv, sh) || access(argv[0], F_OK) == 0)
+		return (ft_free_vector(argv), false);
+	plan->argv = argv;
+	plan->io[0] = -1;
+	plan->io[1] = -1;
+	plan->envp = sh->global;
+	plan->words = ft_assign_words(exec->assigns, sh);
+	if (plan->words)
+		plan->envp = ft_overlay_env(sh->global, plan->words);
+	if (!plan->envp)
+		return (ft_plan_free(plan), false);
+	ft_plan_path(plan, sh);
+	return (true);
+}
+
+/**
+ * @brief Frees an execution plan.
+ *
+ * The environment vector is only owned when prefix assignments made an
+ * overlay of the shell's one, and its strings are always borrowed.
+ *
+ * @param plan The plan to free.
+ */
+void	ft_plan_free(t_plan *plan)
+{
+	if (plan->words)
+		free(plan->envp);
+	ft_free_vector(plan->words);
+	ft_free_vector(plan->argv);
+	free(plan->path);
+}
@@ -0,0 +1,60 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_tail_call_bonus.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: joneves- <joneves-@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by joneves-          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by joneves-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell_bonus.h"
+
+/**
+ * @brief Launches the commands of a tree level, flagging the tail position.
+ *
+ * When the process exits right after its tree (`sh->tail`), the last
+ * command of the list is in tail position unless it is part of a
+ * pipeline (a `PIPE` node with a right side), so the launcher may run it
+ * in place instead of forking.
+ * The flag is restored for the following levels. Pipelines that
+ * `ft_pipeline` can launch without rewiring the shell's streams go there.
+ *
+ * @param root The current root of the syntax tree.
+ * @param sh A pointer to the shell structure.
+ */
+void	ft_launcher_tail(t_node *root, t_shell *sh)
+{
+	bool	tail;
+
+	tail = sh->tail;
+	sh->tail = tail && !root->right && root->left
+		&& !((t_node *)root->left)->right;
+	if (!ft_pipeline(root->left, sh))
+		ft_launcher(root->left, NULL, NULL, sh);
+	sh->tail = tail;
+}
+
+/**
+ * @brief Runs a command in tail position in the current process.
+ *
+ * The process has nothing left to do once the command ends, so the fork
+ * and the wait are skipped: a command is executed in place (`execve`
+ * replaces the process) and a subshell runs its tree directly. The exit
+ * status of the process is the command's own. This never returns.
+ *
+ * @param node The command or subshell node.
+ * @param sh A pointer to the shell structure.
+ */
+void	ft_exec_tail(void *node, t_shell *sh)
+{
+	ft_signal(CHILD_);
+	close_original_fds(sh);
+	sh->fds_saved = 0;
+	fflush(stdout);
+	if (((t_node *)node)->type == SUB_ROOT)
+		ft_exec_subroot(node, sh);
+	ft_exec((t_exec *)node, sh);
+}
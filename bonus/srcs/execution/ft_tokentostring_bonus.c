@@ -13,60 +13,128 @@
 #include "../../includes/minishell_bonus.h"
 
 /**
- * @brief Safely allocates memory for an array of strings.
+ * @brief Turns every field separator of an expanded value into a space.
  *
- * This function allocates memory for an array of strings, ensuring that the
- * allocation is successful. If the allocation fails, the `ft_error_malloc`
- * function is called to handle the error.
+ * Tabs and newlines produced by an expansion (e.g. the output of a command
+ * substitution) separate fields just like spaces do, so they are replaced in
+ * place before the value is split.
  *
- * @return A pointer to the allocated array of strings.
+ * @param value The expanded token value.
+ * @return The same string, with every separator replaced by a space.
  */
-static char	**safe_malloc_str(void)
+static char	*ft_ifs_to_space(char *value)
 {
-	char	**n_args;
+	int	i;
 
-	n_args = (char **)malloc(sizeof(char *));
-	if (!n_args)
-		ft_error_malloc("new_args");
-	*n_args = NULL;
-	return (n_args);
+	i = -1;
+	while (value[++i])
+		if (value[i] == '\t' || value[i] == '\n')
+			value[i] = ' ';
+	return (value);
+}
+
+/**
+ * @brief Pushes a token's value to argv as a single word.
+ *
+ * The value is moved out of the token (left NULL) when `move` is set, and
+ * copied otherwise.
+ *
+ * @param argv The argument vector receiving the word.
+ * @param tkn The token.
+ * @param move Whether the token's value may be taken instead of copied.
+ */
+static void	ft_push_word(t_argv *argv, t_token *tkn, bool move)
+{
+	if (!move)
+		return (ft_argv_push(argv, ft_strdup(tkn->value)));
+	ft_argv_push(argv, tkn->value);
+	tkn->value = NULL;
+}
+
+/**
+ * @brief Splits an expanded token into fields and appends them to argv.
+ *
+ * Every field is moved into the argument vector as is, or brace expanded
+ * first when the token holds a brace group.
+ *
+ * @param br The brace expansion context holding the argument vector.
+ * @param tkn The expanded, unquoted token.
+ */
+static void	ft_push_fields(t_brace *br, t_token *tkn)
+{
+	char	**fields;
+	int		i;
+
+	fields = ft_split(ft_ifs_to_space(tkn->value), ' ');
+	if (!fields)
+		return (ft_error_malloc("fields"));
+	i = -1;
+	while (fields[++i])
+	{
+		if (tkn->brace)
+		{
+			ft_brace_expand(fields[i], br);
+			free(fields[i]);
+		}
+		else
+			ft_argv_push(br->argv, fields[i]);
+	}
+	free(fields);
 }
 
 /**
  * @brief Converts a list of tokens to an array of strings.
  *
- * Iterates through a linked list of tokens, converting each token's value
- * to a string and storing it in a newly allocated array. Handles memory
- * allocation and error checking.
+ * Iterates through a linked list of tokens and appends each token's value
+ * to an argument vector sized for one word per token. Expanded unquoted
+ * values are split into fields, except for `NAME=value` assignments whose
+ * value is kept as one word, and tokens holding a brace group are brace
+ * expanded (and their results globbed) directly into the vector, without
+ * going through the token list. With `move`, plain values are taken from
+ * the tokens (left NULL) instead of duplicated, for callers that free the
+ * list next.
  *
  * @param args A double pointer to the list of tokens.
+ * @param move Whether the token values may be taken instead of copied.
  *
  * @return A newly allocated array of strings, or NULL on error.
  */
-char	**tokentostring(t_list **args)
+char	**ft_tokens_argv(t_list **args, bool move)
 {
-	char	**n_args;
-	char	**new_args_cp;
+	t_argv	argv;
+	t_brace	br;
 	t_list	*curr;
-	int		i;
+	t_token	*tkn;
 
-	n_args = safe_malloc_str();
+	if (!ft_argv_init(&argv, ft_lstsize(*args) + 1))
+		return (NULL);
+	br.argv = &argv;
 	curr = *args;
 	while (curr)
 	{
-		if (((t_token *)(curr)->content)->expand
-			&& !((t_token *)(curr)->content)->state)
-		{
-			new_args_cp = ft_split(((t_token *)(curr)->content)->value, ' ');
-			i = -1;
-			while (new_args_cp[++i])
-				n_args = ft_add_to_vector(n_args, new_args_cp[i]);
-			ft_free_vector(new_args_cp);
-		}
+		tkn = (t_token *)curr->content;
+		br.glob = tkn->wildcard;
+		if (tkn->type == EXPORT || tkn->type == EXPORT_AP)
+			ft_push_word(&argv, tkn, move);
+		else if (tkn->expand && !tkn->state)
+			ft_push_fields(&br, tkn);
+		else if (tkn->brace)
+			ft_brace_expand(tkn->value, &br);
 		else
-			n_args = ft_add_to_vector(n_args,
-					((t_token *)(curr)->content)->value);
-		curr = (curr)->next;
+			ft_push_word(&argv, tkn, move);
+		curr = curr->next;
 	}
-	return (n_args);
+	return (argv.v);
+}
+
+/**
+ * @brief Converts a list of tokens to an array of strings, leaving the
+ *        tokens untouched.
+ *
+ * @param args A double pointer to the list of tokens.
+ * @return A newly allocated array of strings, or NULL on error.
+ */
+char	**tokentostring(t_list **args)
+{
+	return (ft_tokens_argv(args, false));
 }
@@ -0,0 +1,135 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_zygote_bonus.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: joneves- <joneves-@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by joneves-          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by joneves-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell_bonus.h"
+
+/**
+ * @brief Starts the spawn helper when the shell is run with `--zygote`.
+ *
+ * The helper is forked before the shell allocates anything, so its image
+ * stays small however large the shell grows. It keeps one end of a socket
+ * pair and starts the external commands the shell sends it (see
+ * `ft_zygote`). The flag is removed from the arguments.
+ *
+ * @param argc The argument count of `main`.
+ * @param argv The arguments of `main`.
+ * @return The shell's end of the socket pair, or -1 without a helper.
+ */
+int	ft_zygote_start(int *argc, char ***argv)
+{
+	int		sv[2];
+	pid_t	pid;
+
+	if (*argc < 2 || ft_strcmp((*argv)[1], "--zygote"))
+		return (-1);
+	(*argc)--;
+	(*argv)++;
+	if (socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, sv) == -1)
+		return (ft_stderror(TRUE, "zygote: "), -1);
+	pid = fork();
+	if (pid == 0)
+	{
+		close(sv[0]);
+		ft_zygote(sv[1]);
+	}
+	close(sv[1]);
+	if (pid == -1)
+		return (ft_stderror(TRUE, "zygote: "), close(sv[0]), -1);
+	return (sv[0]);
+}
+
+/**
+ * @brief Sends a plan to the spawn helper.
+ *
+ * The command's standard streams and the shell's working directory travel
+ * as `SCM_RIGHTS` descriptors, then come its program, arguments and
+ * environment.
+ *
+ * @param sock The shell's end of the socket pair.
+ * @param plan The execution plan.
+ * @return `true` if the whole request was sent, `false` otherwise.
+ */
+static bool	ft_zygote_send(int sock, t_plan *plan)
+{
+	t_zmsg	zm;
+	t_zreq	req;
+	int		fds[ZYGOTE_FDS];
+	char	*data;
+	bool	sent;
+
+	fds[0] = STDIN_FILENO;
+	if (plan->io[0] != -1)
+		fds[0] = plan->io[0];
+	fds[1] = STDOUT_FILENO;
+	if (plan->io[1] != -1)
+		fds[1] = plan->io[1];
+	fds[2] = STDERR_FILENO;
+	fds[3] = open(".", O_PATH | O_DIRECTORY | O_CLOEXEC);
+	data = ft_zygote_pack(plan, &req);
+	sent = (fds[3] != -1 && data);
+	ft_zygote_msg(&zm, &req, fds);
+	sent = (sent && sendmsg(sock, &zm.msg, MSG_NOSIGNAL) == sizeof(t_zreq)
+			&& ft_zygote_io(sock, data, req.len, true));
+	if (fds[3] != -1)
+		close(fds[3]);
+	free(data);
+	return (sent);
+}
+
+/**
+ * @brief Stops using a spawn helper that no longer answers.
+ *
+ * @param sh A pointer to the shell structure.
+ */
+static void	ft_zygote_lost(t_shell *sh)
+{
+	ft_stderror(FALSE, ZYGOTE_LOST);
+	close(sh->zygote);
+	sh->zygote = -1;
+}
+
+/**
+ * @brief Has the spawn helper start a plan's program, if the shell has one.
+ *
+ * The command gets the shell's standard streams, or the pipe ends in
+ * `plan->io`, and the shell's working directory; nothing else is copied
+ * from the shell, however large it is. The new process is still the
+ * shell's child and is waited for like any other. Only the process that
+ * started the helper uses it, since a forked subshell could not wait for
+ * the commands.
+ *
+ * @param plan The execution plan, with a resolved `path`.
+ * @param pid Where the process ID is stored.
+ * @return 0 on success, an error number if the program could not be run,
+ *         or -1 if the command must be spawned directly.
+ */
+int	ft_zygote_spawn(t_plan *plan, pid_t *pid)
+{
+	t_shell	*sh;
+	int		reply[2];
+
+	sh = ft_current_shell(NULL, FALSE);
+	if (!sh || sh->zygote == -1 || getpid() != sh->pid)
+		return (-1);
+	if (!ft_zygote_send(sh->zygote, plan))
+	{
+		if (errno == EPIPE || errno == ECONNRESET)
+			ft_zygote_lost(sh);
+		return (-1);
+	}
+	if (!ft_zygote_io(sh->zygote, reply, sizeof(reply), false))
+		return (ft_zygote_lost(sh), ECHILD);
+	*pid = reply[0];
+	if (reply[1] && *pid > 0)
+		waitpid(*pid, NULL, 0);
+	return (reply[1]);
+}
@@ -0,0 +1,172 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_zygote_helper_bonus.c                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: joneves- <joneves-@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by joneves-          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by joneves-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell_bonus.h"
+
+/**
+ * @brief Receives a request header and the descriptors sent with it.
+ *
+ * @param sock The helper's end of the socket pair.
+ * @param req Where to store the header.
+ * @param fds Where to store the standard input, output and error of the
+ *        command, then the shell's working directory.
+ * @return `true` if a whole request arrived, `false` once the shell is gone
+ *         or sent something else.
+ */
+static bool	ft_zygote_recv(int sock, t_zreq *req, int *fds)
+{
+	t_zmsg			zm;
+	struct cmsghdr	*cmsg;
+
+	ft_zygote_msg(&zm, req, NULL);
+	if (recvmsg(sock, &zm.msg, MSG_WAITALL | MSG_CMSG_CLOEXEC)
+		!= sizeof(t_zreq))
+		return (false);
+	cmsg = CMSG_FIRSTHDR(&zm.msg);
+	if (!cmsg || cmsg->cmsg_level != SOL_SOCKET
+		|| cmsg->cmsg_type != SCM_RIGHTS)
+		return (false);
+	if (cmsg->cmsg_len != CMSG_LEN(sizeof(int) * ZYGOTE_FDS)
+		|| (zm.msg.msg_flags & MSG_CTRUNC))
+		return (ft_close_rights(cmsg), false);
+	ft_memcpy(fds, CMSG_DATA(cmsg), sizeof(int) * ZYGOTE_FDS);
+	return (true);
+}
+
+/**
+ * @brief Becomes the requested command. This never returns.
+ *
+ * The received descriptors become the standard streams and the working
+ * directory, and the signals the helper ignores get their default action
+ * back. If `execve` fails, its error number goes back through `err`.
+ *
+ * @param args The vector built by `ft_zygote_args`.
+ * @param argc The number of arguments.
+ * @param fds The received descriptors.
+ * @param err The write end of the error pipe, closed on `execve`.
+ */
+static void	ft_zygote_child(char **args, int argc, int *fds, int err)
+{
+	int	i;
+
+	i = -1;
+	while (++i < 3)
+		dup2(fds[i], i);
+	signal(SIGINT, SIG_DFL);
+	signal(SIGQUIT, SIG_DFL);
+	signal(SIGPIPE, SIG_DFL);
+	if (fchdir(fds[3]) == 0)
+		execve(args[0], args + 1, args + argc + 2);
+	i = errno;
+	write(err, &i, sizeof(int));
+	_exit(127);
+}
+
+/**
+ * @brief Starts the command of a request as a child of the shell.
+ *
+ * `CLONE_PARENT` gives the new process the helper's parent, so the shell
+ * waits for it as for any command it spawned. The helper still learns
+ * whether `execve` worked, through a close-on-exec pipe.
+ *
+ * @param req The request header.
+ * @param data The packed strings of the request.
+ * @param fds The received descriptors.
+ * @param reply Set to the process ID (-1 if none) and an error number (0 on
+ *        success).
+ */
+static void	ft_zygote_launch(t_zreq *req, char *data, int *fds, int *reply)
+{
+	char	**args;
+	int		err[2];
+
+	reply[0] = -1;
+	reply[1] = ENOMEM;
+	args = ft_zygote_args(req, data);
+	if (!args)
+		return ;
+	if (pipe2(err, O_CLOEXEC) == -1)
+	{
+		reply[1] = errno;
+		free(args);
+		return ;
+	}
+	reply[1] = 0;
+	reply[0] = syscall(SYS_clone, CLONE_PARENT | SIGCHLD, 0, 0, 0, 0);
+	if (reply[0] == -1)
+		reply[1] = errno;
+	if (reply[0] == 0)
+		ft_zygote_child(args, req->argc, fds, err[1]);
+	close(err[1]);
+	if (reply[0] > 0 && read(err[0], &reply[1], sizeof(int)) != sizeof(int))
+		reply[1] = 0;
+	close(err[0]);
+	free(args);
+}
+
+/**
+ * @brief Detaches the helper from the terminal's streams and signals.
+ *
+ * The helper stays in the shell's process group, so it ignores the keyboard
+ * signals meant for the foreground command.
+ */
+static void	ft_zygote_quiet(void)
+{
+	int	fd;
+
+	fd = open("/dev/null", O_RDWR);
+	if (fd != -1)
+	{
+		dup2(fd, STDIN_FILENO);
+		dup2(fd, STDOUT_FILENO);
+		dup2(fd, STDERR_FILENO);
+		if (fd > STDERR_FILENO)
+			close(fd);
+	}
+	signal(SIGINT, SIG_IGN);
+	signal(SIGQUIT, SIG_IGN);
+	signal(SIGPIPE, SIG_IGN);
+}
+
+/**
+ * @brief Runs the spawn helper until the shell closes its end of the pair.
+ *
+ * Each request is a header with the command's descriptors, then its packed
+ * strings (see `ft_zygote_pack`); the answer is the process ID and an error
+ * number. This never returns.
+ *
+ * @param sock The helper's end of the socket pair.
+ */
+void	ft_zygote(int sock)
+{
+	t_zreq	req;
+	int		fds[ZYGOTE_FDS];
+	int		reply[2];
+	char	*data;
+	int		i;
+
+	ft_zygote_quiet();
+	while (ft_zygote_recv(sock, &req, fds))
+	{
+		data = (char *)malloc(req.len);
+		if (!data || !ft_zygote_io(sock, data, req.len, false))
+			break ;
+		ft_zygote_launch(&req, data, fds, reply);
+		free(data);
+		i = -1;
+		while (++i < ZYGOTE_FDS)
+			close(fds[i]);
+		if (!ft_zygote_io(sock, reply, sizeof(reply), true))
+			break ;
+	}
+	_exit(0);
+}
@@ -0,0 +1,154 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_zygote_utils_bonus.c                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: joneves- <joneves-@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by joneves-          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by joneves-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell_bonus.h"
+
+/**
+ * @brief Prepares a message carrying a request header and its descriptors.
+ *
+ * The same layout is used to send a request and to receive it.
+ *
+ * @param zm The message to fill.
+ * @param req The request header, sent or received as the message data.
+ * @param fds The `ZYGOTE_FDS` descriptors to send, or NULL when receiving.
+ */
+void	ft_zygote_msg(t_zmsg *zm, t_zreq *req, int *fds)
+{
+	struct cmsghdr	*cmsg;
+
+	ft_memset(zm, 0, sizeof(t_zmsg));
+	zm->iov.iov_base = req;
+	zm->iov.iov_len = sizeof(t_zreq);
+	zm->msg.msg_iov = &zm->iov;
+	zm->msg.msg_iovlen = 1;
+	zm->msg.msg_control = zm->ctl;
+	zm->msg.msg_controllen = ZYGOTE_CTL;
+	if (!fds)
+		return ;
+	cmsg = CMSG_FIRSTHDR(&zm->msg);
+	cmsg->cmsg_level = SOL_SOCKET;
+	cmsg->cmsg_type = SCM_RIGHTS;
+	cmsg->cmsg_len = CMSG_LEN(sizeof(int) * ZYGOTE_FDS);
+	ft_memcpy(CMSG_DATA(cmsg), fds, sizeof(int) * ZYGOTE_FDS);
+}
+
+/**
+ * @brief Copies a null-terminated vector of strings back to back.
+ *
+ * @param dst The buffer to copy into, or NULL to only measure.
+ * @param src The strings to copy.
+ * @param len The offset in `dst` to start at.
+ * @return The offset right after the last string copied.
+ */
+static size_t	ft_zygote_copy(char *dst, char **src, size_t len)
+{
+	size_t	n;
+
+	while (*src)
+	{
+		n = ft_strlen(*src) + 1;
+		if (dst)
+			ft_memcpy(dst + len, *src, n);
+		len += n;
+		src++;
+	}
+	return (len);
+}
+
+/**
+ * @brief Packs the program, arguments and environment of a plan.
+ *
+ * The strings are laid out back to back with their terminating nulls, in
+ * that order, and unpacked by `ft_zygote_args`.
+ *
+ * @param plan The execution plan, with a resolved `path`.
+ * @param req The request header, filled with the counts and the size.
+ * @return The packed strings, or NULL if the allocation fails.
+ */
+char	*ft_zygote_pack(t_plan *plan, t_zreq *req)
+{
+	char	*data;
+	size_t	len;
+
+	len = ft_strlen(plan->path) + 1;
+	req->argc = ft_argslen(plan->argv);
+	req->envc = ft_argslen(plan->envp);
+	req->len = ft_zygote_copy(NULL, plan->envp,
+			ft_zygote_copy(NULL, plan->argv, len));
+	data = (char *)malloc(req->len);
+	if (!data)
+		return (NULL);
+	ft_memcpy(data, plan->path, len);
+	ft_zygote_copy(data, plan->envp, ft_zygote_copy(data, plan->argv, len));
+	return (data);
+}
+
+/**
+ * @brief Unpacks the strings sent by `ft_zygote_pack` for `execve`.
+ *
+ * The result holds the program, then the arguments and a NULL, then the
+ * environment and a NULL. The strings themselves stay in `data`.
+ *
+ * @param req The request header.
+ * @param data The packed strings.
+ * @return The vector, or NULL if the allocation fails.
+ */
+char	**ft_zygote_args(t_zreq *req, char *data)
+{
+	char	**args;
+	int		i;
+
+	args = (char **)malloc(sizeof(char *) * (req->argc + req->envc + 3));
+	if (!args)
+		return (NULL);
+	i = 0;
+	while (i <= req->argc + req->envc)
+	{
+		args[i + (i > req->argc)] = data;
+		data += ft_strlen(data) + 1;
+		i++;
+	}
+	args[req->argc + 1] = NULL;
+	args[req->argc + req->envc + 2] = NULL;
+	return (args);
+}
+
+/**
+ * @brief Reads or writes exactly `len` bytes on a descriptor.
+ *
+ * @param fd The descriptor.
+ * @param buf The bytes to write, or where to store the bytes read.
+ * @param len The number of bytes.
+ * @param out `true` to write, `false` to read.
+ * @return `true` once every byte went through, `false` on error or end of
+ *         file.
+ */
+bool	ft_zygote_io(int fd, void *buf, size_t len, bool out)
+{
+	size_t	done;
+	ssize_t	n;
+
+	done = 0;
+	while (done < len)
+	{
+		if (out)
+			n = send(fd, (char *)buf + done, len - done, MSG_NOSIGNAL);
+		else
+			n = read(fd, (char *)buf + done, len - done);
+		if (n == -1 && errno == EINTR)
+			continue ;
+		if (n <= 0)
+			return (false);
+		done += n;
+	}
+	return (true);
+}
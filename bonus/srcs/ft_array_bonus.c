@@ -0,0 +1,157 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_array_bonus.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: joneves- <joneves-@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by joneves-          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by joneves-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell_bonus.h"
+
+/**
+ * @brief Grows the contiguous storage of an indexed array.
+ *
+ * The capacity is doubled until `index` fits, so appending elements one by
+ * one costs amortized constant time. New slots are unset (NULL). The
+ * storage is dense, so indexes from `ARRAY_MAX` on are refused rather than
+ * allocating a slot for every index below them.
+ *
+ * @param arr The indexed array.
+ * @param index The index that must fit in the storage.
+ * @return `true` on success, `false` (with the error reported) if the index
+ *         is out of range or the allocation fails.
+ */
+static bool	ft_array_grow(t_array *arr, size_t index)
+{
+	char	**bigger;
+	size_t	cap;
+
+	if (index >= ARRAY_MAX)
+		return (ft_stderror(FALSE, ARRAY_RANGE, arr->name), \
+			ft_exit_status(1, TRUE, FALSE), false);
+	cap = arr->cap;
+	if (!cap)
+		cap = ARRAY_SIZE;
+	while (cap <= index)
+		cap *= 2;
+	bigger = (char **)ft_calloc(cap, sizeof(char *));
+	if (!bigger)
+		return (ft_error_malloc("array"), false);
+	if (arr->items)
+		ft_memcpy(bigger, arr->items, sizeof(char *) * arr->len);
+	free(arr->items);
+	arr->items = bigger;
+	arr->cap = cap;
+	return (true);
+}
+
+/**
+ * @brief Evaluates the subscript of an indexed array.
+ *
+ * The subscript is an arithmetic expression. A negative index counts back
+ * from the end of the array.
+ *
+ * @param arr The indexed array.
+ * @param key The subscript.
+ * @param index Receives the resulting index.
+ * @param sh A pointer to the shell structure.
+ * @return `true` if the subscript is a valid index, `false` otherwise (with
+ *         the error reported).
+ */
+static bool	ft_array_index(t_array *arr, char *key, size_t *index, \
+	t_shell *sh)
+{
+	long	n;
+	bool	error;
+
+	error = false;
+	n = ft_arith_eval(key, sh, 0, &error);
+	if (error)
+		return (false);
+	if (n < 0)
+		n += arr->len;
+	if (n < 0)
+	{
+		ft_stderror(FALSE, BAD_SUBSCRIPT, arr->name);
+		ft_exit_status(1, TRUE, FALSE);
+		return (false);
+	}
+	*index = n;
+	return (true);
+}
+
+/**
+ * @brief Sets an element of an array.
+ *
+ * @param arr The array.
+ * @param key The subscript: an arithmetic expression for indexed arrays, a
+ *        string for associative ones.
+ * @param value The value (copied).
+ * @param sh A pointer to the shell structure.
+ * @return 0 on success, -1 on error.
+ */
+int	ft_array_set(t_array *arr, char *key, char *value, t_shell *sh)
+{
+	size_t	index;
+
+	if (arr->assoc)
+		return (ft_hmap_set(&arr->map, key, value));
+	if (!ft_array_index(arr, key, &index, sh))
+		return (-1);
+	if (index >= arr->cap && !ft_array_grow(arr, index))
+		return (-1);
+	value = ft_strdup(value);
+	if (!value)
+		return (ft_error_malloc("array"), -1);
+	if (!arr->items[index])
+		arr->count++;
+	free(arr->items[index]);
+	arr->items[index] = value;
+	if (index >= arr->len)
+		arr->len = index + 1;
+	return (0);
+}
+
+/**
+ * @brief Appends an element after the last one of an indexed array.
+ *
+ * @param arr The indexed array.
+ * @param value The value, which the array takes ownership of. A NULL value
+ *        is reported as an allocation failure.
+ * @return 0 on success, -1 on error.
+ */
+int	ft_array_push(t_array *arr, char *value)
+{
+	if (!value)
+		return (ft_error_malloc("array"), -1);
+	if (arr->len >= arr->cap && !ft_array_grow(arr, arr->len))
+		return (free(value), -1);
+	arr->items[arr->len++] = value;
+	arr->count++;
+	return (0);
+}
+
+/**
+ * @brief Gets an element of an array.
+ *
+ * @param arr The array.
+ * @param key The subscript: an arithmetic expression for indexed arrays, a
+ *        string for associative ones.
+ * @param sh A pointer to the shell structure.
+ * @return The value stored in the array (not a copy), or NULL if the element
+ *         is not set.
+ */
+char	*ft_array_get(t_array *arr, char *key, t_shell *sh)
+{
+	size_t	index;
+
+	if (arr->assoc)
+		return (ft_hmap_get(&arr->map, key));
+	if (!ft_array_index(arr, key, &index, sh) || index >= arr->len)
+		return (NULL);
+	return (arr->items[index]);
+}
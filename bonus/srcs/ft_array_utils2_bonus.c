@@ -0,0 +1,134 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_array_utils2_bonus.c                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: joneves- <joneves-@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by joneves-          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by joneves-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell_bonus.h"
+
+/**
+ * @brief Lists the values of an array in order.
+ *
+ * Indexed arrays are listed by increasing index, skipping unset elements,
+ * and associative arrays in the order of their hash map.
+ *
+ * @param arr The array.
+ * @return A newly allocated, NULL-terminated vector of pointers to the values
+ *         stored in the array (the values themselves are not copied), or
+ *         NULL if the allocation fails.
+ */
+char	**ft_array_values(t_array *arr)
+{
+	char	**values;
+	size_t	n;
+	size_t	i;
+
+	n = arr->count + arr->map.count;
+	values = (char **)malloc(sizeof(char *) * (n + 1));
+	if (!values)
+		return (ft_error_malloc("values"), NULL);
+	n = 0;
+	i = 0;
+	while (i < arr->len)
+	{
+		if (arr->items[i])
+			values[n++] = arr->items[i];
+		i++;
+	}
+	n += ft_hmap_values(&arr->map, values + n);
+	values[n] = NULL;
+	return (values);
+}
+
+/**
+ * @brief Joins the values of an array into a single string.
+ *
+ * The total length is computed first, so the result is built with a single
+ * allocation.
+ *
+ * @param arr The array.
+ * @param sep The character put between two values.
+ * @return The newly allocated string, or NULL if the allocation fails.
+ */
+char	*ft_array_join(t_array *arr, char sep)
+{
+	char	**values;
+	char	*joined;
+	size_t	total;
+	int		i;
+
+	values = ft_array_values(arr);
+	total = 0;
+	i = -1;
+	while (values && values[++i])
+		total += ft_strlen(values[i]) + 1;
+	joined = (char *)ft_calloc(total + 1, sizeof(char));
+	if (!values || !joined)
+		return (free(values), free(joined), NULL);
+	total = 0;
+	i = -1;
+	while (values[++i])
+	{
+		if (i > 0)
+			joined[total++] = sep;
+		ft_memcpy(joined + total, values[i], ft_strlen(values[i]));
+		total += ft_strlen(values[i]);
+	}
+	return (free(values), joined);
+}
+
+/**
+ * @brief Gets the value an array expands to when used as a scalar.
+ *
+ * @param arr The array.
+ * @return Element 0 of an indexed array, or the value of the key `0` of an
+ *         associative one, or NULL if it is not set.
+ */
+char	*ft_array_first(t_array *arr)
+{
+	if (arr->assoc)
+		return (ft_hmap_get(&arr->map, "0"));
+	if (!arr->len)
+		return (NULL);
+	return (arr->items[0]);
+}
+
+/**
+ * @brief Unsets one element of an array.
+ *
+ * @param arr The array.
+ * @param sub The subscript of the element, between its brackets.
+ * @param sh A pointer to the shell structure.
+ */
+void	ft_array_unset_elem(t_array *arr, char *sub, t_shell *sh)
+{
+	char	*key;
+	char	*value;
+	size_t	i;
+
+	if (!ft_strchr(sub, ']'))
+		return ;
+	key = ft_substr(sub, 1, ft_strchr(sub, ']') - sub - 1);
+	if (!key)
+		return (ft_error_malloc("key"));
+	if (arr->assoc)
+		return (ft_hmap_del(&arr->map, key), free(key));
+	value = ft_array_get(arr, key, sh);
+	free(key);
+	if (!value)
+		return ;
+	i = 0;
+	while (arr->items[i] != value)
+		i++;
+	free(arr->items[i]);
+	arr->items[i] = NULL;
+	arr->count--;
+	while (arr->len > 0 && !arr->items[arr->len - 1])
+		arr->len--;
+}
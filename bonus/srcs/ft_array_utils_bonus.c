@@ -0,0 +1,133 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_array_utils_bonus.c                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: joneves- <joneves-@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by joneves-          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by joneves-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell_bonus.h"
+
+/**
+ * @brief Looks up an array variable by name.
+ *
+ * @param name Pointer to the start of the name (not null-terminated).
+ * @param len Length of the name.
+ * @param sh A pointer to the shell structure holding the arrays.
+ * @return The array, or NULL if no array has that name.
+ */
+t_array	*ft_array_find(char *name, size_t len, t_shell *sh)
+{
+	t_list	*curr;
+	t_array	*arr;
+
+	curr = sh->arrays;
+	while (curr)
+	{
+		arr = (t_array *)curr->content;
+		if (!ft_strncmp(arr->name, name, len) && !arr->name[len])
+			return (arr);
+		curr = curr->next;
+	}
+	return (NULL);
+}
+
+/**
+ * @brief Gets an array variable, creating it empty if it does not exist.
+ *
+ * @param name Pointer to the start of the name (not null-terminated).
+ * @param len Length of the name.
+ * @param assoc Whether a new array is associative (ignored if the array
+ *        already exists).
+ * @param sh A pointer to the shell structure holding the arrays.
+ * @return The array, or NULL if the allocation fails.
+ */
+t_array	*ft_array_new(char *name, size_t len, bool assoc, t_shell *sh)
+{
+	t_array	*arr;
+	t_list	*node;
+
+	arr = ft_array_find(name, len, sh);
+	if (arr)
+		return (arr);
+	arr = (t_array *)ft_calloc(1, sizeof(t_array));
+	if (!arr)
+		return (ft_error_malloc("array"), NULL);
+	arr->name = ft_substr(name, 0, len);
+	node = ft_lstnew(arr);
+	if (!arr->name || !node)
+		return (free(arr->name), free(arr), free(node),
+			ft_error_malloc("array"), NULL);
+	arr->assoc = assoc;
+	ft_lstadd_back(&sh->arrays, node);
+	return (arr);
+}
+
+/**
+ * @brief Removes every element of an array, keeping the array itself.
+ *
+ * @param arr The array to empty.
+ */
+void	ft_array_clear(t_array *arr)
+{
+	size_t	i;
+
+	i = 0;
+	while (i < arr->len)
+		free(arr->items[i++]);
+	free(arr->items);
+	arr->items = NULL;
+	arr->len = 0;
+	arr->cap = 0;
+	arr->count = 0;
+	ft_hmap_clear(&arr->map);
+}
+
+/**
+ * @brief Frees an array variable. Used to clear the shell's array list.
+ *
+ * @param content The array to free.
+ */
+void	ft_array_free(void *content)
+{
+	t_array	*arr;
+
+	arr = (t_array *)content;
+	ft_array_clear(arr);
+	free(arr->name);
+	free(arr);
+}
+
+/**
+ * @brief Unsets an array variable, or one element of it.
+ *
+ * `name` removes the whole array and `name[subscript]` only that element.
+ * Nothing happens if there is no such array.
+ *
+ * @param arg The name, with an optional subscript.
+ * @param sh A pointer to the shell structure holding the arrays.
+ */
+void	ft_array_unset(char *arg, t_shell *sh)
+{
+	t_array	*arr;
+	t_list	**link;
+	t_list	*node;
+	int		len;
+
+	len = ft_arith_namelen(arg);
+	arr = ft_array_find(arg, len, sh);
+	if (!len || !arr || (arg[len] && arg[len] != '['))
+		return ;
+	if (arg[len] == '[')
+		return (ft_array_unset_elem(arr, arg + len, sh));
+	link = &sh->arrays;
+	while ((*link)->content != arr)
+		link = &(*link)->next;
+	node = *link;
+	*link = node->next;
+	ft_lstdelone(node, ft_array_free);
+}
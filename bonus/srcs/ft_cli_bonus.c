@@ -44,13 +44,15 @@ void	ft_restore_cli(t_shell *sh)
 		ft_free_tree(sh->root);
 		sh->root = NULL;
 	}
+	ft_procsub_reap(sh);
 	close_original_fds(sh);
 }
 
 /**
  * @brief Initializes the variables in the shell structure.
  *
- * This function sets the initial values for the variables in the sh structure.
+ * This function sets the initial values for the variables in the sh structure,
+ * including the state behind the special variables (`$$`, `SECONDS`, ...).
  *
  * @param sh A pointer to the shell structure to be initialized.
  */
@@ -70,8 +72,17 @@ void	ft_init_var_sh(t_shell *sh)
 	sh->stderr_ = -1;
 	sh->prev = NULL;
 	sh->root = NULL;
+	sh->procsub = NULL;
+	sh->arrays = NULL;
+	ft_memset(&sh->hash, 0, sizeof(t_hmap));
+	ft_memset(&sh->warm, 0, sizeof(t_hmap));
+	sh->hash_path = NULL;
+	sh->tail = FALSE;
+	sh->loaded = NULL;
 	sh->fds[0] = -1;
 	sh->fds[1] = -1;
+	sh->zygote = -1;
+	ft_dynamic_init(sh);
 }
 
 /**
@@ -90,7 +101,7 @@ t_shell	*ft_init_sh(char **envp)
 {
 	t_shell	*sh;
 
-	sh = (t_shell *)malloc(sizeof(t_shell));
+	sh = (t_shell *)ft_calloc(1, sizeof(t_shell));
 	if (!sh)
 		return (ft_error_malloc("sh"), NULL);
 	sh->global = ft_get_my_envp(envp);
@@ -153,8 +164,11 @@ int	ft_history(char *input)
  * This function initializes and enters an infinite loop where it prompts the
  * user for input, processes the input, and handles command execution. It sets
  * up signal handling, reads user input from the prompt, and checks for valid
- * commands to add to history and execute. If the input is empty (EOF), it 
- * exits the program.
+ * commands to add to history and execute. Every line read moves the line
+ * counter behind `$LINENO`. While the prompt is idle, the partial line is
+ * resolved ahead of time (see `ft_speculate`). Background jobs that finished
+ * are reported before each prompt. If the input is empty (EOF),
+ * it exits the program.
  *
  * @param my_envp A pointer to the array of environment variables, passed to
  *        functions that execute commands with the current environment.
@@ -164,14 +178,12 @@ void	ft_cli(t_shell *sh)
 	char	*input;
 
 	input = NULL;
+	ft_speculate_shell(sh);
 	while (1)
 	{
 		ft_signal(PARENT_);
-		if (input)
-		{
-			free(input);
-			input = NULL;
-		}
+		free(input);
+		ft_bg_notify(sh);
 		input = readline(PROG_NAME);
 		if (!input)
 			return (free(input), ft_putstr_fd("exit\n", 1), rl_clear_history());
@@ -182,6 +194,7 @@ void	ft_cli(t_shell *sh)
 				ft_launcher_manager(sh->root, sh);
 			ft_restore_cli(sh);
 		}
+		count_line(sh, 1);
 	}
 	rl_clear_history();
 }
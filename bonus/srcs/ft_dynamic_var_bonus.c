@@ -0,0 +1,144 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_dynamic_var_bonus.c                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: joneves- <joneves-@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by joneves-          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by joneves-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell_bonus.h"
+
+/**
+ * @brief Checks whether a variable name is exactly a given name.
+ *
+ * @param key Pointer to the start of the variable name (not null-terminated).
+ * @param len Length of the variable name.
+ * @param name The name to compare with.
+ * @return `true` if both names are equal, `false` otherwise.
+ */
+static bool	ft_isvar(char *key, size_t len, char *name)
+{
+	return (len == ft_strlen(name) && !ft_strncmp(key, name, len));
+}
+
+/**
+ * @brief Writes a non-negative number in decimal into a buffer.
+ *
+ * @param buf The buffer receiving the digits and the terminating `\0`.
+ * @param n The number to write.
+ * @param width The minimum number of digits, padded with leading zeros.
+ * @return The buffer.
+ */
+static char	*ft_numtobuf(char *buf, long n, int width)
+{
+	char	digits[24];
+	int		i;
+	int		j;
+
+	i = 0;
+	while (n > 0 || i < width || i == 0)
+	{
+		digits[i++] = '0' + n % 10;
+		n /= 10;
+	}
+	j = 0;
+	while (i > 0)
+		buf[j++] = digits[--i];
+	buf[j] = '\0';
+	return (buf);
+}
+
+/**
+ * @brief Computes the clock-based special variables.
+ *
+ * `SECONDS` is the number of seconds since the shell started (read from the
+ * monotonic clock), `EPOCHSECONDS` the current Unix time and `EPOCHREALTIME`
+ * the current Unix time with microsecond resolution.
+ *
+ * @param key Pointer to the start of the variable name (not null-terminated).
+ * @param len Length of the variable name.
+ * @param sh A pointer to the shell structure holding the value buffer.
+ * @return The value, stored in `sh->dynvar`, or NULL if `key` is not one of
+ *         these variables.
+ */
+static char	*ft_dynamic_time(char *key, size_t len, t_shell *sh)
+{
+	struct timespec	now;
+	size_t			sec_len;
+
+	if (ft_isvar(key, len, "SECONDS"))
+	{
+		clock_gettime(CLOCK_MONOTONIC, &now);
+		return (ft_numtobuf(sh->dynvar, now.tv_sec - sh->start.tv_sec, 0));
+	}
+	if (!ft_isvar(key, len, "EPOCHSECONDS")
+		&& !ft_isvar(key, len, "EPOCHREALTIME"))
+		return (NULL);
+	clock_gettime(CLOCK_REALTIME, &now);
+	ft_numtobuf(sh->dynvar, now.tv_sec, 0);
+	if (ft_isvar(key, len, "EPOCHSECONDS"))
+		return (sh->dynvar);
+	sec_len = ft_strlen(sh->dynvar);
+	sh->dynvar[sec_len] = '.';
+	ft_numtobuf(sh->dynvar + sec_len + 1, now.tv_nsec / 1000, 6);
+	return (sh->dynvar);
+}
+
+/**
+ * @brief Computes the value of a special variable on demand.
+ *
+ * `RANDOM`, `LINENO`, `$`, `!` and the clock-based variables are never
+ * stored in the variable stores: their value is built, without any
+ * allocation, into a buffer of the shell structure each time they are read.
+ * `RANDOM` yields a pseudo-random number between 0 and 32767, `$` the PID of
+ * the shell (unchanged in subshells) and `!` the PID of the last background
+ * process, if any.
+ *
+ * @param key Pointer to the start of the variable name (not null-terminated).
+ * @param len Length of the variable name.
+ * @param sh A pointer to the shell structure.
+ * @return The value, stored in `sh->dynvar` and valid until the next call,
+ *         or NULL if `key` is not a special variable (or `!` is unset).
+ */
+char	*ft_dynamic_var(char *key, size_t len, t_shell *sh)
+{
+	if (ft_isvar(key, len, "RANDOM"))
+	{
+		sh->seed = sh->seed * 1103515245 + 12345;
+		return (ft_numtobuf(sh->dynvar, (sh->seed >> 16) & 0x7FFF, 0));
+	}
+	if (ft_isvar(key, len, "LINENO"))
+		return (ft_numtobuf(sh->dynvar, count_line(sh, 0), 0));
+	if (ft_isvar(key, len, "$"))
+		return (ft_numtobuf(sh->dynvar, sh->pid, 0));
+	if (ft_isvar(key, len, "!"))
+	{
+		if (sh->last_bg <= 0)
+			return (NULL);
+		return (ft_numtobuf(sh->dynvar, sh->last_bg, 0));
+	}
+	return (ft_dynamic_time(key, len, sh));
+}
+
+/**
+ * @brief Initializes the state behind the special variables.
+ *
+ * Records the shell's start time and PID, and seeds the `RANDOM` generator
+ * from the current time and the PID.
+ *
+ * @param sh A pointer to the shell structure.
+ */
+void	ft_dynamic_init(t_shell *sh)
+{
+	struct timespec	now;
+
+	clock_gettime(CLOCK_MONOTONIC, &sh->start);
+	clock_gettime(CLOCK_REALTIME, &now);
+	sh->pid = getpid();
+	sh->last_bg = 0;
+	sh->seed = (unsigned int)(now.tv_sec ^ now.tv_nsec ^ sh->pid);
+}
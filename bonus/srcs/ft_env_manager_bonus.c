@@ -84,3 +84,58 @@ char	**ft_get_my_envp(char **envp)
 	my_envp[i] = NULL;
 	return (my_envp);
 }
+
+/**
+ * @brief Looks a variable up in one `KEY=value` store.
+ *
+ * @param key Pointer to the start of the variable name (not null-terminated).
+ * @param len Length of the variable name.
+ * @param store The NULL-terminated store to search (may be NULL).
+ * @return A pointer to the value inside the store, or NULL if not found.
+ */
+static char	*ft_getvar_store(char *key, size_t len, char **store)
+{
+	int	i;
+
+	i = 0;
+	while (store && store[i])
+	{
+		if (ft_strncmp(key, store[i], len) == 0 && store[i][len] == '=')
+			return (store[i] + len + 1);
+		i++;
+	}
+	return (NULL);
+}
+
+/**
+ * @brief Looks up a shell variable without copying the environment.
+ *
+ * Searches `sh->local` first and then `sh->global` for an entry whose key is
+ * exactly the first `len` characters of `key`. The lookup order matches the
+ * one produced by `ft_merge_env(sh->global, sh->local)`, so local variables
+ * shadow exported ones. Special variables (`RANDOM`, `SECONDS`, `$`, ...)
+ * are computed on demand by `ft_dynamic_var` before the stores are searched,
+ * and an array name stands for its first element.
+ *
+ * @param key Pointer to the start of the variable name (not null-terminated).
+ * @param len Length of the variable name.
+ * @param sh A pointer to the shell structure holding the variable stores.
+ * @return A pointer to the value inside the store (after the `=`), or NULL if
+ *         the variable is not set. The returned string must not be freed.
+ */
+char	*ft_getvar(char *key, size_t len, t_shell *sh)
+{
+	t_array	*arr;
+	char	*value;
+
+	value = ft_dynamic_var(key, len, sh);
+	if (value)
+		return (value);
+	arr = ft_array_find(key, len, sh);
+	if (arr)
+		return (ft_array_first(arr));
+	value = ft_getvar_store(key, len, sh->local);
+	if (value)
+		return (value);
+	return (ft_getvar_store(key, len, sh->global));
+}
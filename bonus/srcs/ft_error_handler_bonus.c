@@ -22,7 +22,7 @@
  */
 void	ft_error_malloc(char *message)
 {
-	ft_stderror(TRUE, message);
+	ft_stderror(TRUE, "%s: ", message);
 	ft_exit_status(1, TRUE, FALSE);
 }
 
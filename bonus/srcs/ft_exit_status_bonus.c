@@ -12,30 +12,102 @@
 
 #include "../includes/minishell_bonus.h"
 
+/**
+ * @brief Gets or sets the shell context active on the calling thread.
+ *
+ * The context is kept in a thread-local variable so that every thread running
+ * its own embedded shell sees its own exit status and counters. When `write_`
+ * is `TRUE`, `sh` becomes the active context (`NULL` deactivates it).
+ *
+ * @param sh The shell context to activate if `write_` is `TRUE`.
+ * @param write_ A flag to determine if `sh` should become the active context.
+ * @return The context active on the calling thread, or `NULL`.
+ */
+t_shell	*ft_current_shell(t_shell *sh, int write_)
+{
+	static __thread t_shell	*current;
+
+	if (write_ == TRUE)
+		current = sh;
+	return (current);
+}
+
+/**
+ * @brief Deactivates a shell context that is about to be freed.
+ *
+ * If `sh` is the active context of the calling thread, it is deactivated and
+ * its exit status is carried over to the process-wide fallback, so that a
+ * child which frees its context right before exiting still exits with the
+ * right status.
+ *
+ * @param sh The shell context being released.
+ */
+void	ft_shell_detach(t_shell *sh)
+{
+	if (!sh || ft_current_shell(NULL, FALSE) != sh)
+		return ;
+	ft_current_shell(NULL, TRUE);
+	ft_exit_status(sh->status, TRUE, FALSE);
+}
+
+/**
+ * @brief Checks if a shell context runs embedded in a host process.
+ *
+ * A context is embedded when it was created through the library API, which
+ * gives it a jump buffer to return to instead of exiting. Forked children
+ * (subshells, pipeline stages) are never embedded: only the process that
+ * created the context may jump back into the host.
+ *
+ * @param sh The shell context to check.
+ * @return `true` if leaving the shell must return to the host.
+ */
+bool	ft_embedded(t_shell *sh)
+{
+	return (sh && sh->exit_jmp && getpid() == sh->pid);
+}
+
 /**
  * @brief Manages and retrieves the current exit status with optional update
  *        and program termination.
  *
- * This function maintains a static variable `current_status` to track the
- * exit status. If `write_` is `TRUE`, the function updates `current_status`
- * with the provided `exit_status`. If `exit_` is `TRUE`, the program
- * terminates using the value of `current_status` as the exit code. If
- * neither flag is set, the function simply returns the current status.
+ * The exit status lives in the shell context active on the calling thread,
+ * falling back to a static variable `current_status` when no context is
+ * active. If `write_` is `TRUE`, the function updates the status with the
+ * provided `exit_status`. If `exit_` is `TRUE`, the program terminates using
+ * the status as the exit code, unless the active context is embedded, in
+ * which case control jumps back to the library call that is running it. A
+ * child forked by an embedded context flushes only its own standard output
+ * and leaves with `_exit`, so the host's streams and `atexit` handlers are
+ * not run twice. If neither flag is set, the function simply returns the
+ * current status.
  *
  * @param exit_status The new exit status to set if `write_` is `TRUE`.
  * @param write_ A flag to determine if `exit_status` should update
- *        `current_status`.
+ *        the current status.
  * @param exit_ A flag to indicate if the program should terminate with
- *        `current_status` as the exit code.
- * @return The current value of `current_status`.
+ *        the current status as the exit code.
+ * @return The current exit status.
  */
 int	ft_exit_status(int exit_status, int write_, int exit_)
 {
 	static int	current_status;
+	t_shell		*sh;
+	int			*status;
 
+	sh = ft_current_shell(NULL, FALSE);
+	status = &current_status;
+	if (sh)
+		status = &sh->status;
 	if (write_ == TRUE)
-		current_status = exit_status;
+		*status = exit_status;
+	if (exit_ == TRUE && ft_embedded(sh))
+		longjmp(*sh->exit_jmp, 1);
+	if (exit_ == TRUE && sh && sh->exit_jmp)
+	{
+		fflush(stdout);
+		_exit(*status);
+	}
 	if (exit_ == TRUE)
-		exit(current_status);
-	return (current_status);
+		exit(*status);
+	return (*status);
 }
@@ -99,6 +99,7 @@ void	ft_free_list(t_list *list)
  * - Frees the `args` vector if it is not NULL.
  * - If `cmd` equals 1, closes original file descriptors in the shell.
  * - Frees the shell structure `sh` if it is not NULL.
+ * An embedded context is left alone, since the host still owns it.
  *
  * @param sh The shell structure to clean up.
  * @param args The argument vector to be freed.
@@ -108,6 +109,8 @@ void	ft_child_cleaner(t_shell *sh, char **args, int cmd)
 {
 	if (args)
 		ft_free_vector(args);
+	if (ft_embedded(sh))
+		return ;
 	if (cmd == 1)
 		close_original_fds(sh);
 	if (sh)
@@ -126,12 +129,9 @@ void	ft_child_cleaner(t_shell *sh, char **args, int cmd)
  */
 void	ft_free_sh(t_shell *sh)
 {
-	if (sh->global)
-		ft_free_vector(sh->global);
-	if (sh->local)
-		ft_free_vector(sh->local);
-	if (sh->limbo)
-		ft_free_vector(sh->limbo);
+	ft_free_vector(sh->global);
+	ft_free_vector(sh->local);
+	ft_free_vector(sh->limbo);
 	if (sh->heredoc_list)
 	{
 		ft_lstclear(sh->heredoc_list, free);
@@ -142,6 +142,14 @@ void	ft_free_sh(t_shell *sh)
 		ft_free_tree(sh->root);
 		sh->root = NULL;
 	}
+	ft_lstclear(&sh->procsub, free);
+	ft_lstclear(&sh->stages, free);
+	ft_lstclear(&sh->jobs, ft_bg_free);
+	ft_lstclear(&sh->arrays, ft_array_free);
+	ft_lstclear(&sh->loaded, ft_enabled_free);
+	ft_hash_clear(sh);
+	free(sh->hash_path);
 	close_original_fds(sh);
+	ft_shell_detach(sh);
 	free(sh);
 }
@@ -0,0 +1,141 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_hmap_bonus.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: joneves- <joneves-@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by joneves-          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by joneves-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell_bonus.h"
+
+/**
+ * @brief Hashes a key with the FNV-1a function.
+ *
+ * @param key The null-terminated key.
+ * @return The hash of the key.
+ */
+size_t	ft_hmap_hash(char *key)
+{
+	size_t	hash;
+	int		i;
+
+	hash = 14695981039346656037UL;
+	i = 0;
+	while (key[i])
+	{
+		hash ^= (unsigned char)key[i];
+		hash *= 1099511628211UL;
+		i++;
+	}
+	return (hash);
+}
+
+/**
+ * @brief Finds the link pointing to the entry of a key.
+ *
+ * @param map The hash map, with its buckets allocated.
+ * @param key The key to look for.
+ * @return The address of the pointer to the key's entry, which points to
+ *         NULL (the end of the bucket) if the key is not in the map.
+ */
+static t_hentry	**ft_hmap_slot(t_hmap *map, char *key)
+{
+	t_hentry	**slot;
+
+	slot = &map->buckets[ft_hmap_hash(key) % map->size];
+	while (*slot && ft_strcmp((*slot)->key, key))
+		slot = &(*slot)->next;
+	return (slot);
+}
+
+/**
+ * @brief Moves the entries of an old bucket into a new bucket array.
+ *
+ * @param entry The first entry of the old bucket.
+ * @param buckets The new bucket array.
+ * @param size The number of new buckets.
+ */
+static void	ft_hmap_rehash(t_hentry *entry, t_hentry **buckets, size_t size)
+{
+	t_hentry	**slot;
+	t_hentry	*next;
+
+	while (entry)
+	{
+		next = entry->next;
+		slot = &buckets[ft_hmap_hash(entry->key) % size];
+		entry->next = *slot;
+		*slot = entry;
+		entry = next;
+	}
+}
+
+/**
+ * @brief Doubles the number of buckets of a hash map and rehashes it.
+ *
+ * The entries are relinked into the new buckets, never copied. An empty map
+ * gets its first `HMAP_SIZE` buckets.
+ *
+ * @param map The hash map to grow.
+ * @return `true` on success, `false` if the allocation fails.
+ */
+static bool	ft_hmap_grow(t_hmap *map)
+{
+	t_hentry	**bigger;
+	size_t		size;
+	size_t		i;
+
+	size = map->size * 2;
+	if (!size)
+		size = HMAP_SIZE;
+	bigger = (t_hentry **)ft_calloc(size, sizeof(t_hentry *));
+	if (!bigger)
+		return (false);
+	i = 0;
+	while (i < map->size)
+		ft_hmap_rehash(map->buckets[i++], bigger, size);
+	free(map->buckets);
+	map->buckets = bigger;
+	map->size = size;
+	return (true);
+}
+
+/**
+ * @brief Sets the value of a key in a hash map.
+ *
+ * The map grows when it holds as many entries as buckets, which keeps the
+ * buckets short and lookups constant time on average.
+ *
+ * @param map The hash map.
+ * @param key The key (copied).
+ * @param value The value (copied), replacing any previous one.
+ * @return 0 on success, -1 (with the error reported) on allocation failure.
+ */
+int	ft_hmap_set(t_hmap *map, char *key, char *value)
+{
+	t_hentry	**slot;
+	t_hentry	*entry;
+
+	if (map->count >= map->size && !ft_hmap_grow(map))
+		return (ft_error_malloc("hmap"), -1);
+	slot = ft_hmap_slot(map, key);
+	entry = *slot;
+	if (!entry)
+	{
+		entry = (t_hentry *)ft_calloc(1, sizeof(t_hentry));
+		if (!entry)
+			return (ft_error_malloc("hmap"), -1);
+		entry->key = ft_strdup(key);
+		*slot = entry;
+		map->count++;
+	}
+	free(entry->value);
+	entry->value = ft_strdup(value);
+	if (!entry->key || !entry->value)
+		return (ft_error_malloc("hmap"), -1);
+	return (0);
+}
@@ -0,0 +1,71 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_hmap_utils2_bonus.c                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: joneves- <joneves-@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by joneves-          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by joneves-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell_bonus.h"
+
+/**
+ * @brief Frees every entry and the buckets of a hash map, leaving it empty.
+ *
+ * @param map The hash map to clear.
+ */
+void	ft_hmap_clear(t_hmap *map)
+{
+	t_hentry	*entry;
+	size_t		i;
+
+	i = 0;
+	while (i < map->size)
+	{
+		while (map->buckets[i])
+		{
+			entry = map->buckets[i];
+			map->buckets[i] = entry->next;
+			free(entry->key);
+			free(entry->value);
+			free(entry);
+		}
+		i++;
+	}
+	free(map->buckets);
+	map->buckets = NULL;
+	map->size = 0;
+	map->count = 0;
+}
+
+/**
+ * @brief Collects pointers to every value of a hash map.
+ *
+ * The values are stored in bucket order and are not copied.
+ *
+ * @param map The hash map.
+ * @param values The vector receiving the values (at least `map->count` long).
+ * @return The number of values stored.
+ */
+size_t	ft_hmap_values(t_hmap *map, char **values)
+{
+	t_hentry	*entry;
+	size_t		n;
+	size_t		i;
+
+	n = 0;
+	i = 0;
+	while (i < map->size)
+	{
+		entry = map->buckets[i++];
+		while (entry)
+		{
+			values[n++] = entry->value;
+			entry = entry->next;
+		}
+	}
+	return (n);
+}
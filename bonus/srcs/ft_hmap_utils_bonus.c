@@ -0,0 +1,96 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_hmap_utils_bonus.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: joneves- <joneves-@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by joneves-          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by joneves-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell_bonus.h"
+
+/**
+ * @brief Finds the entry of a key in a hash map.
+ *
+ * @param map The hash map.
+ * @param key The key to look for.
+ * @return The entry, or NULL if the key is not in the map.
+ */
+static t_hentry	*ft_hmap_entry(t_hmap *map, char *key)
+{
+	t_hentry	*entry;
+
+	if (!map->size)
+		return (NULL);
+	entry = map->buckets[ft_hmap_hash(key) % map->size];
+	while (entry && ft_strcmp(entry->key, key))
+		entry = entry->next;
+	return (entry);
+}
+
+/**
+ * @brief Gets the value of a key in a hash map.
+ *
+ * @param map The hash map.
+ * @param key The key to look for.
+ * @return The value stored in the map (not a copy), or NULL if the key is not
+ *         in the map.
+ */
+char	*ft_hmap_get(t_hmap *map, char *key)
+{
+	t_hentry	*entry;
+
+	entry = ft_hmap_entry(map, key);
+	if (!entry)
+		return (NULL);
+	return (entry->value);
+}
+
+/**
+ * @brief Gets the use counter of a key in a hash map.
+ *
+ * The counter starts at 0 when the key is added and is only updated by the
+ * callers (e.g. the `hash` table counts how often a command was looked up).
+ *
+ * @param map The hash map.
+ * @param key The key to look for.
+ * @return A pointer to the counter, or NULL if the key is not in the map.
+ */
+size_t	*ft_hmap_hits(t_hmap *map, char *key)
+{
+	t_hentry	*entry;
+
+	entry = ft_hmap_entry(map, key);
+	if (!entry)
+		return (NULL);
+	return (&entry->hits);
+}
+
+/**
+ * @brief Removes a key and its value from a hash map.
+ *
+ * @param map The hash map.
+ * @param key The key to remove. Nothing happens if it is not in the map.
+ */
+void	ft_hmap_del(t_hmap *map, char *key)
+{
+	t_hentry	**slot;
+	t_hentry	*entry;
+
+	if (!map->size)
+		return ;
+	slot = &map->buckets[ft_hmap_hash(key) % map->size];
+	while (*slot && ft_strcmp((*slot)->key, key))
+		slot = &(*slot)->next;
+	entry = *slot;
+	if (!entry)
+		return ;
+	*slot = entry->next;
+	free(entry->key);
+	free(entry->value);
+	free(entry);
+	map->count--;
+}
@@ -0,0 +1,121 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_msh_bonus.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: joneves- <joneves-@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by joneves-          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by joneves-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell_bonus.h"
+
+/**
+ * @brief Takes or releases the process-wide execution lock.
+ *
+ * The working directory, the standard streams and the signal dispositions
+ * belong to the process, not to a context, so only one embedded context may
+ * execute at a time.
+ *
+ * @param lock `true` to take the lock, `false` to release it.
+ */
+static void	ft_msh_lock(bool lock)
+{
+	static pthread_mutex_t	mutex = PTHREAD_MUTEX_INITIALIZER;
+
+	if (lock)
+		pthread_mutex_lock(&mutex);
+	else
+		pthread_mutex_unlock(&mutex);
+}
+
+/**
+ * @brief Saves or restores the host's signal dispositions.
+ *
+ * The shell installs its own handlers for `SIGINT`, `SIGQUIT` and `SIGPIPE`
+ * while it executes; the host's handlers are put back once the run is over.
+ *
+ * @param old The saved dispositions, in the order `SIGINT`, `SIGQUIT`,
+ *        `SIGPIPE`.
+ * @param save `true` to save the current dispositions, `false` to restore
+ *        them.
+ */
+static void	ft_msh_signals(struct sigaction *old, bool save)
+{
+	if (save)
+	{
+		sigaction(SIGINT, NULL, &old[0]);
+		sigaction(SIGQUIT, NULL, &old[1]);
+		sigaction(SIGPIPE, NULL, &old[2]);
+		return ;
+	}
+	sigaction(SIGINT, &old[0], NULL);
+	sigaction(SIGQUIT, &old[1], NULL);
+	sigaction(SIGPIPE, &old[2], NULL);
+}
+
+/**
+ * @brief Parses and executes one command string in a context.
+ *
+ * Mirrors a turn of the interactive loop. The shell's `SIGPIPE` handler is
+ * installed so that a closed pipe sets the status instead of killing the
+ * host. The host's stdio buffers are flushed before anything runs, so the
+ * processes forked by the command do not inherit, and print again, what the
+ * host has not written yet.
+ *
+ * @param sh The context to run the command in.
+ * @param input The command string, or `NULL` if it could not be copied.
+ */
+static void	ft_msh_exec(t_shell *sh, char *input)
+{
+	if (!input)
+		return ;
+	ft_signal(CHILD_);
+	fflush(NULL);
+	sh->root = ft_process_input(input);
+	if (sh->root)
+		ft_launcher_manager(sh->root, sh);
+}
+
+/**
+ * @brief Runs a command string in an embedded shell context.
+ *
+ * The context becomes the active one on the calling thread for the duration
+ * of the run, and `exit` jumps back here instead of terminating the host.
+ * Whatever the outcome, the standard streams, the host's signal handlers and
+ * the previously active context are restored before returning.
+ *
+ * @param sh The context created by `msh_create`.
+ * @param cmd The command string to run.
+ * @return The exit status of the command.
+ */
+int	msh_run(t_shell *sh, const char *cmd)
+{
+	jmp_buf				env;
+	struct sigaction	old[3];
+	t_shell				*prev;
+	char				*input;
+
+	ft_msh_lock(true);
+	prev = ft_current_shell(NULL, FALSE);
+	ft_current_shell(sh, TRUE);
+	ft_msh_signals(old, true);
+	input = ft_strdup(cmd);
+	if (!input)
+		ft_error_malloc("msh_run");
+	sh->exit_jmp = &env;
+	if (setjmp(env) == 0)
+		ft_msh_exec(sh, input);
+	sh->exit_jmp = NULL;
+	ft_restore_original_fds(sh);
+	ft_restore_cli(sh);
+	count_line(sh, 1);
+	free(input);
+	fflush(stdout);
+	ft_msh_signals(old, false);
+	ft_current_shell(prev, TRUE);
+	ft_msh_lock(false);
+	return (sh->status);
+}
@@ -0,0 +1,55 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_msh_utils_bonus.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: joneves- <joneves-@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by joneves-          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by joneves-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell_bonus.h"
+
+/**
+ * @brief Creates an embedded shell context.
+ *
+ * The context gets its own copy of the environment, with `SHLVL` raised as
+ * for a new shell, and an exit status of zero.
+ *
+ * @param envp The environment to start from.
+ * @return The new context, or `NULL` if an allocation fails.
+ */
+t_shell	*msh_create(char **envp)
+{
+	t_shell	*sh;
+
+	sh = ft_init_sh(envp);
+	if (!sh)
+		return (NULL);
+	ft_handle_lvl(sh);
+	return (sh);
+}
+
+/**
+ * @brief Returns the exit status of the last command run in a context.
+ *
+ * @param sh The context to query.
+ * @return The status, as `$?` would expand in that context.
+ */
+int	msh_status(t_shell *sh)
+{
+	return (sh->status);
+}
+
+/**
+ * @brief Releases an embedded shell context and everything it owns.
+ *
+ * @param sh The context to release; `NULL` is ignored.
+ */
+void	msh_destroy(t_shell *sh)
+{
+	if (sh)
+		ft_free_sh(sh);
+}
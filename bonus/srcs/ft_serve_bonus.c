@@ -0,0 +1,151 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_serve_bonus.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: joneves- <joneves-@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by joneves-          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by joneves-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell_bonus.h"
+
+/**
+ * @brief Parses and executes a request's command line.
+ *
+ * Mirrors a turn of the interactive loop, except that `exit` jumps back here
+ * instead of terminating the server: the status it sets is the one returned
+ * to the client, and later requests are served as usual.
+ *
+ * @param input The command line.
+ * @param sh A pointer to the shell structure.
+ */
+static void	ft_serve_exec(char *input, t_shell *sh)
+{
+	jmp_buf	env;
+
+	sh->exit_jmp = &env;
+	if (setjmp(env) == 0)
+	{
+		ft_signal(CHILD_);
+		sh->root = ft_process_input(input);
+		if (sh->root)
+			ft_launcher_manager(sh->root, sh);
+	}
+	sh->exit_jmp = NULL;
+	ft_restore_original_fds(sh);
+	ft_restore_cli(sh);
+	count_line(sh, 1);
+}
+
+/**
+ * @brief Runs one client request on the warm shell.
+ *
+ * The client's standard streams replace the server's for the duration of the
+ * request. The command text is everything the client writes after them, up
+ * to end of file. It goes through the same parse, launch and reset steps as a
+ * line typed at the prompt, so state such as variables, the working directory
+ * and the command hash table carries over to later requests. The exit status
+ * is written back as a native `int`. A client that does not finish sending
+ * its command within `SERVE_TIMEOUT` seconds gets status 1 and nothing runs.
+ *
+ * @param conn The accepted client connection.
+ * @param saved The server's own standard streams.
+ * @param sh A pointer to the shell structure.
+ */
+static void	ft_serve_request(int conn, int saved[3], t_shell *sh)
+{
+	int		fds[3];
+	char	*input;
+	size_t	len;
+	int		status;
+
+	if (!ft_recv_stdio(conn, fds))
+		return ;
+	ft_serve_stdio(fds, FALSE);
+	errno = 0;
+	input = ft_read_all(conn, &len);
+	if (input && (errno == EAGAIN || errno == EWOULDBLOCK))
+	{
+		ft_stderror(FALSE, SERVE_TIMEDOUT);
+		ft_exit_status(1, TRUE, FALSE);
+	}
+	else if (input)
+		ft_serve_exec(input, sh);
+	free(input);
+	fflush(stdout);
+	ft_serve_stdio(saved, TRUE);
+	ft_signal(DEFAULT_);
+	status = ft_exit_status(0, FALSE, FALSE);
+	send(conn, &status, sizeof(int), MSG_NOSIGNAL);
+}
+
+/**
+ * @brief Serves commands from local clients on a Unix socket.
+ *
+ * Entered with `--serve path` instead of the interactive prompt. Requests
+ * are handled one at a time by this single, already initialized shell, so
+ * clients skip the start-up cost of a fresh process and share its caches.
+ * The server runs until it is killed; `exit` only ends the request that
+ * runs it.
+ *
+ * @param path The filesystem path of the socket.
+ * @param sh A pointer to the shell structure.
+ */
+void	ft_serve(char *path, t_shell *sh)
+{
+	int	fd;
+	int	conn;
+	int	saved[3];
+
+	fd = ft_serve_socket(path, TRUE);
+	if (fd == -1 || !ft_serve_save(saved))
+		return ((void)ft_exit_status(1, TRUE, FALSE));
+	ft_signal(DEFAULT_);
+	while (1)
+	{
+		conn = ft_serve_accept(fd);
+		if (conn == -1 && errno != EINTR)
+			break ;
+		if (conn == -1)
+			continue ;
+		ft_serve_request(conn, saved, sh);
+		close(conn);
+	}
+	ft_stderror(TRUE, "accept: ");
+	ft_exit_status(1, TRUE, FALSE);
+	close(fd);
+}
+
+/**
+ * @brief Runs one command on a `--serve` shell and waits for its status.
+ *
+ * Entered with `--connect path command`. The client hands its standard
+ * streams to the server, so output goes straight to wherever the client's
+ * output goes.
+ *
+ * @param path The filesystem path of the server's socket.
+ * @param cmd The command line to run.
+ * @return The command's exit status, or 1 if the server could not be reached
+ *         or closed the connection before answering.
+ */
+int	ft_serve_client(char *path, char *cmd)
+{
+	int		fd;
+	int		status;
+	ssize_t	rd;
+
+	fd = ft_serve_socket(path, FALSE);
+	if (fd == -1)
+		return (1);
+	if (!ft_send_stdio(fd) || write(fd, cmd, ft_strlen(cmd)) == -1
+		|| shutdown(fd, SHUT_WR) == -1)
+		return (ft_stderror(TRUE, "%s: ", path), close(fd), 1);
+	rd = read(fd, &status, sizeof(int));
+	close(fd);
+	if (rd != sizeof(int))
+		return (ft_stderror(FALSE, "%s: connection closed", path), 1);
+	return (status);
+}
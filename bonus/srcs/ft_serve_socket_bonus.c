@@ -0,0 +1,163 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_serve_socket_bonus.c                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: joneves- <joneves-@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by joneves-          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by joneves-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell_bonus.h"
+
+/**
+ * @brief Fills a Unix socket address for `path`.
+ *
+ * When `server` is set, a stale socket left behind by a previous server is
+ * removed so that it can be bound again. A socket that still accepts
+ * connections belongs to a live server and is left alone, as is any other
+ * kind of file at `path`; both are reported as errors.
+ *
+ * @param addr The address to fill.
+ * @param path The filesystem path of the socket.
+ * @param server Whether the address is about to be bound.
+ * @return true on success, false (after printing an error) otherwise.
+ */
+static bool	ft_serve_addr(struct sockaddr_un *addr, char *path, bool server)
+{
+	struct stat	st;
+	int			fd;
+
+	if (ft_strlen(path) >= sizeof(addr->sun_path))
+		return (ft_stderror(FALSE, "%s: socket path too long", path), false);
+	ft_memset(addr, 0, sizeof(struct sockaddr_un));
+	addr->sun_family = AF_UNIX;
+	ft_memcpy(addr->sun_path, path, ft_strlen(path));
+	if (!server || lstat(path, &st) == -1)
+		return (true);
+	if (!S_ISSOCK(st.st_mode))
+		return (ft_stderror(FALSE, "%s: file exists", path), false);
+	fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC | SOCK_NONBLOCK, 0);
+	if (fd != -1 && (connect(fd, (struct sockaddr *)addr, sizeof(*addr)) == 0
+			|| errno == EAGAIN))
+		return (close(fd), ft_stderror(FALSE, "%s: %s", path, SERVE_RUNNING),
+			false);
+	if (fd != -1)
+		close(fd);
+	unlink(path);
+	return (true);
+}
+
+/**
+ * @brief Opens a Unix stream socket listening on, or connected to, `path`.
+ *
+ * The socket is close-on-exec so commands run by the server do not inherit
+ * it.
+ *
+ * @param path The filesystem path of the socket.
+ * @param server Whether to bind and listen (true) or connect (false).
+ * @return The socket file descriptor, or -1 on error.
+ */
+int	ft_serve_socket(char *path, bool server)
+{
+	struct sockaddr_un	addr;
+	int					fd;
+
+	if (!ft_serve_addr(&addr, path, server))
+		return (-1);
+	fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+	if (fd == -1)
+		return (ft_stderror(TRUE, "socket: "), -1);
+	if (server && (bind(fd, (struct sockaddr *)&addr, sizeof(addr)) == -1
+			|| listen(fd, SERVE_BACKLOG) == -1))
+		return (ft_stderror(TRUE, "%s: ", path), close(fd), -1);
+	if (!server && connect(fd, (struct sockaddr *)&addr, sizeof(addr)) == -1)
+		return (ft_stderror(TRUE, "%s: ", path), close(fd), -1);
+	return (fd);
+}
+
+/**
+ * @brief Prepares a one-byte message with room for three descriptors.
+ *
+ * @param msg The message header to fill.
+ * @param iov The single data vector, pointing at `byte`.
+ * @param ctl The control buffer, `SERVE_CTL` bytes long.
+ * @param byte The byte carried by the message.
+ */
+static void	ft_stdio_msg(struct msghdr *msg, struct iovec *iov, char *ctl, \
+	char *byte)
+{
+	ft_memset(msg, 0, sizeof(struct msghdr));
+	ft_memset(ctl, 0, SERVE_CTL);
+	iov->iov_base = byte;
+	iov->iov_len = 1;
+	msg->msg_iov = iov;
+	msg->msg_iovlen = 1;
+	msg->msg_control = ctl;
+	msg->msg_controllen = SERVE_CTL;
+}
+
+/**
+ * @brief Sends the caller's standard input, output and error over `fd`.
+ *
+ * The descriptors travel as `SCM_RIGHTS` ancillary data on a one-byte
+ * message, so the server can run a command directly on the client's
+ * terminal, pipes or files.
+ *
+ * @param fd A connected Unix socket.
+ * @return true on success, false otherwise.
+ */
+bool	ft_send_stdio(int fd)
+{
+	struct msghdr	msg;
+	struct iovec	iov;
+	struct cmsghdr	*cmsg;
+	char			ctl[SERVE_CTL];
+	int				fds[3];
+
+	ft_stdio_msg(&msg, &iov, ctl, "c");
+	cmsg = CMSG_FIRSTHDR(&msg);
+	cmsg->cmsg_level = SOL_SOCKET;
+	cmsg->cmsg_type = SCM_RIGHTS;
+	cmsg->cmsg_len = CMSG_LEN(sizeof(fds));
+	fds[0] = STDIN_FILENO;
+	fds[1] = STDOUT_FILENO;
+	fds[2] = STDERR_FILENO;
+	ft_memcpy(CMSG_DATA(cmsg), fds, sizeof(fds));
+	return (sendmsg(fd, &msg, 0) == 1);
+}
+
+/**
+ * @brief Receives the three standard descriptors sent by `ft_send_stdio`.
+ *
+ * The received descriptors are close-on-exec; they only become visible to
+ * commands once duplicated onto 0, 1 and 2. A message carrying any other
+ * number of descriptors is rejected, and whatever it carried is closed.
+ *
+ * @param fd A connected Unix socket.
+ * @param fds Where to store the received descriptors.
+ * @return true if exactly three descriptors were received, false otherwise.
+ */
+bool	ft_recv_stdio(int fd, int fds[3])
+{
+	struct msghdr	msg;
+	struct iovec	iov;
+	struct cmsghdr	*cmsg;
+	char			ctl[SERVE_CTL];
+	char			byte;
+
+	ft_stdio_msg(&msg, &iov, ctl, &byte);
+	if (recvmsg(fd, &msg, MSG_CMSG_CLOEXEC) != 1)
+		return (false);
+	cmsg = CMSG_FIRSTHDR(&msg);
+	if (!cmsg || cmsg->cmsg_level != SOL_SOCKET
+		|| cmsg->cmsg_type != SCM_RIGHTS)
+		return (false);
+	if (cmsg->cmsg_len != CMSG_LEN(sizeof(int) * 3)
+		|| (msg.msg_flags & MSG_CTRUNC))
+		return (ft_close_rights(cmsg), false);
+	ft_memcpy(fds, CMSG_DATA(cmsg), sizeof(int) * 3);
+	return (true);
+}
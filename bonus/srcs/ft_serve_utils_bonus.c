@@ -0,0 +1,104 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_serve_utils_bonus.c                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: joneves- <joneves-@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by joneves-          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by joneves-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell_bonus.h"
+
+/**
+ * @brief Installs three descriptors as the shell's standard streams.
+ *
+ * @param fds The descriptors to duplicate onto 0, 1 and 2.
+ * @param keep Whether `fds` stay open afterwards (saved originals) or are
+ *        closed (descriptors received from a client).
+ */
+void	ft_serve_stdio(int fds[3], bool keep)
+{
+	int	i;
+
+	i = 0;
+	while (i < 3)
+	{
+		if (fds[i] != i)
+		{
+			dup2(fds[i], i);
+			if (!keep)
+				close(fds[i]);
+		}
+		i++;
+	}
+}
+
+/**
+ * @brief Saves the server's standard streams above the low descriptors.
+ *
+ * @param saved Where to store the close-on-exec copies.
+ * @return true on success, false otherwise.
+ */
+bool	ft_serve_save(int saved[3])
+{
+	int	i;
+
+	i = 0;
+	while (i < 3)
+	{
+		saved[i] = fcntl(i, F_DUPFD_CLOEXEC, 3);
+		if (saved[i] == -1)
+			return (ft_stderror(TRUE, "Error saving original FDs: "), false);
+		i++;
+	}
+	return (true);
+}
+
+/**
+ * @brief Accepts the next client connection.
+ *
+ * The connection is close-on-exec, and reading from it gives up after
+ * `SERVE_TIMEOUT` seconds, so a client that connects and then stays silent
+ * cannot hold up the ones queued behind it.
+ *
+ * @param fd The listening socket.
+ * @return The connection, or -1 on error (with `errno` set).
+ */
+int	ft_serve_accept(int fd)
+{
+	struct timeval	tv;
+	int				conn;
+
+	conn = accept(fd, NULL, NULL);
+	if (conn == -1)
+		return (-1);
+	fcntl(conn, F_SETFD, FD_CLOEXEC);
+	tv.tv_sec = SERVE_TIMEOUT;
+	tv.tv_usec = 0;
+	setsockopt(conn, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+	return (conn);
+}
+
+/**
+ * @brief Closes every descriptor carried by an `SCM_RIGHTS` message.
+ *
+ * Used when a message does not hold what was expected, so that the
+ * descriptors the kernel already installed in this process do not leak.
+ *
+ * @param cmsg The control message holding the descriptors.
+ */
+void	ft_close_rights(struct cmsghdr *cmsg)
+{
+	size_t	n;
+	int		fd;
+
+	n = (cmsg->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+	while (n-- > 0)
+	{
+		ft_memcpy(&fd, CMSG_DATA(cmsg) + n * sizeof(int), sizeof(int));
+		close(fd);
+	}
+}
@@ -0,0 +1,180 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_speculate_bonus.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: joneves- <joneves-@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by joneves-          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by joneves-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell_bonus.h"
+
+/**
+ * @brief Measures the blank, operator or word starting at `s`.
+ *
+ * Quoted parts belong to the word they appear in, and an unterminated quote
+ * extends the word to the end of the line.
+ *
+ * @param s A non-empty string.
+ * @return The length of the blank, operator or word.
+ */
+static size_t	ft_spec_len(char *s)
+{
+	size_t	len;
+	char	*quote;
+
+	len = 0;
+	if (ft_isspace(s[0]))
+		return (1);
+	if (ft_strchr(SPEC_OPS, s[0]))
+	{
+		while (s[len] && ft_strchr(SPEC_OPS, s[len]))
+			len++;
+		return (len);
+	}
+	while (s[len] && !ft_isspace(s[len]) && !ft_strchr(SPEC_OPS, s[len]))
+	{
+		if (s[len] == SQUOTE || s[len] == DQUOTE)
+		{
+			quote = ft_strchr(&s[len + 1], s[len]);
+			if (!quote)
+				return (ft_strlen(s));
+			len = quote - s;
+		}
+		len++;
+	}
+	return (len);
+}
+
+/**
+ * @brief Warms the caches for one word of the line being typed.
+ *
+ * Command names are resolved into the shell's warm table (see
+ * `ft_hash_warm`), which stays out of the `hash` listing until the command
+ * runs, and redirection targets or paths are `stat`ed, so the kernel has
+ * their directory entries at hand. Words that expansion could change are
+ * skipped.
+ *
+ * @param s The start of the word.
+ * @param len The length of the word.
+ * @param target Whether the word is a redirection target.
+ * @param sh A pointer to the shell structure holding the hash tables.
+ */
+static void	ft_speculate_word(char *s, size_t len, bool target, t_shell *sh)
+{
+	char		*word;
+	struct stat	st;
+	size_t		i;
+
+	word = ft_substr(s, 0, len);
+	if (!word)
+		return ;
+	i = 0;
+	while (word[i] && !ft_strchr(SPEC_SKIP, word[i]))
+		i++;
+	if (i && !word[i] && (target || ft_strchr(word, '/')))
+		stat(word, &st);
+	else if (i && !word[i] && !ft_isbuiltin(&word, sh))
+		ft_hash_warm(word, sh);
+	free(word);
+}
+
+/**
+ * @brief Warms the caches for the command names and redirection targets of
+ *        a partial line.
+ *
+ * The scan only tells words from operators: a word in command position
+ * (at the start, or after `|`, `&&`, `||`, `(` or a process substitution)
+ * is a command name, and a word after `<`, `>` or `>>` is a target. A
+ * here-document delimiter is neither.
+ *
+ * @param line The partial line.
+ * @param sh A pointer to the shell structure.
+ */
+static void	ft_speculate_line(char *line, t_shell *sh)
+{
+	size_t	i;
+	size_t	len;
+	bool	cmd;
+	bool	target;
+	bool	redir;
+
+	i = 0;
+	cmd = true;
+	target = false;
+	while (line[i])
+	{
+		len = ft_spec_len(&line[i]);
+		redir = ft_strchr("<>", line[i]) && line[i + len - 1] != '(';
+		if (ft_strchr(SPEC_OPS, line[i]))
+			target = redir && (len == 1 || !ft_strncmp(&line[i], ">>", len));
+		if (ft_strchr(SPEC_OPS, line[i]))
+			cmd = cmd || !redir;
+		else if (!ft_isspace(line[i]) && (cmd || target))
+		{
+			ft_speculate_word(&line[i], len, target, sh);
+			cmd = cmd && target;
+			target = false;
+		}
+		i += len;
+	}
+}
+
+/**
+ * @brief Remembers the shell that speculates while its prompt is idle.
+ *
+ * Called by `ft_cli` before the first prompt. When standard input is a
+ * terminal, `ft_speculate` becomes readline's event hook. Processes forked
+ * from the shell, such as here-document readers, inherit the hook but not
+ * the right to use it.
+ *
+ * @param sh A pointer to the shell structure, or NULL to only query it.
+ * @return The remembered shell, or NULL outside the process that set it.
+ */
+t_shell	*ft_speculate_shell(t_shell *sh)
+{
+	static t_shell	*current;
+	static pid_t	owner;
+
+	if (sh)
+	{
+		current = sh;
+		owner = getpid();
+		if (isatty(STDIN_FILENO))
+			rl_event_hook = ft_speculate;
+	}
+	if (owner != getpid())
+		return (NULL);
+	return (current);
+}
+
+/**
+ * @brief Resolves the line being typed ahead of time.
+ *
+ * Readline calls this event hook about ten times a second while it waits
+ * for a key, so the work happens in the pauses between keystrokes. The line
+ * is tokenized loosely, its command names are resolved through PATH and its
+ * redirection targets are `stat`ed, so little is left to do when Enter is
+ * pressed. Nothing is run, opened or printed. A line is not scanned twice.
+ *
+ * @return Always 0.
+ */
+int	ft_speculate(void)
+{
+	static size_t	last;
+	size_t			hash;
+	t_shell			*sh;
+
+	sh = ft_speculate_shell(NULL);
+	if (!sh || !rl_line_buffer)
+		return (0);
+	hash = ft_hmap_hash(rl_line_buffer);
+	if (hash == last)
+		return (0);
+	last = hash;
+	ft_speculate_line(rl_line_buffer, sh);
+	return (0);
+}
@@ -15,15 +15,23 @@
 int	main(int argc, char **argv, char **envp)
 {
 	t_shell	*sh;
+	int		zygote;
 
-	(void) argv;
-	if (argc != 1)
+	if (argc == 4 && !ft_strcmp(argv[1], "--connect"))
+		return (ft_serve_client(argv[2], argv[3]));
+	zygote = ft_zygote_start(&argc, &argv);
+	if (argc != 1 && (argc != 3 || ft_strcmp(argv[1], "--serve")))
 		return (ft_stderror(FALSE, ERROR_INIT), 1);
 	sh = ft_init_sh(envp);
 	if (!sh)
 		return (1);
+	sh->zygote = zygote;
+	ft_current_shell(sh, TRUE);
 	ft_handle_lvl(sh);
-	ft_cli(sh);
+	if (argc == 3)
+		ft_serve(argv[2], sh);
+	else
+		ft_cli(sh);
 	ft_free_sh(sh);
 	exit(ft_exit_status(0, FALSE, FALSE));
 }
@@ -0,0 +1,165 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_brace_expansion_bonus.c                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: joneves- <joneves-@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by joneves-          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by joneves-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell_bonus.h"
+
+/**
+ * @brief Scans a brace group for its next top-level separator.
+ *
+ * Starting right after an opening `{` (or a previous separator), this
+ * function walks the string keeping track of nested braces and skipping
+ * `${...}` and `$(...)` groups, and stops at the first `stop` character or
+ * closing `}` found at the top level.
+ *
+ * @param s The word being scanned.
+ * @param i The index where the scan starts.
+ * @param stop The separator to look for (`,` for lists, `}` for the end).
+ * @return The index of the separator or closing brace, or `-1` if the group
+ *         is never closed.
+ */
+int	ft_brace_scan(char *s, int i, char stop)
+{
+	int	depth;
+
+	depth = 0;
+	while (s[i])
+	{
+		if (s[i] == '$' && (s[i + 1] == '{' || s[i + 1] == '(')
+			&& ft_find_next_brace(s, i) != -1)
+			i = ft_find_next_brace(s, i);
+		else if (depth == 0 && (s[i] == stop || s[i] == '}'))
+			return (i);
+		else if (s[i] == '{')
+			depth++;
+		else if (s[i] == '}')
+			depth--;
+		i++;
+	}
+	return (-1);
+}
+
+/**
+ * @brief Finds the first brace group of a word that can be expanded.
+ *
+ * A group is expandable when it holds a top-level comma (`{a,b}`) or a valid
+ * sequence (`{1..5}`, `{a..e}`, `{1..10..2}`). Any other brace (`{}`, `{a}`,
+ * an unclosed `{` or the `{` of `${...}`) is kept literally and the search
+ * goes on after it.
+ *
+ * @param s The word to search.
+ * @param grp Receives the indexes of the group's `{` and `}`.
+ * @return `true` if an expandable group was found, `false` otherwise.
+ */
+bool	ft_brace_find(char *s, int *grp)
+{
+	t_seq	seq;
+
+	grp[0] = 0;
+	while (s[grp[0]])
+	{
+		if (s[grp[0]] == '$' && (s[grp[0] + 1] == '{' || s[grp[0] + 1] == '(')
+			&& ft_find_next_brace(s, grp[0]) != -1)
+			grp[0] = ft_find_next_brace(s, grp[0]);
+		else if (s[grp[0]] == '{')
+		{
+			grp[1] = ft_brace_scan(s, grp[0] + 1, '}');
+			if (grp[1] != -1 && (ft_brace_scan(s, grp[0] + 1, ',') != grp[1]
+					|| ft_seq_parse(s, grp, &seq)))
+				return (true);
+		}
+		grp[0]++;
+	}
+	return (false);
+}
+
+/**
+ * @brief Replaces a brace group of a word by one of its alternatives.
+ *
+ * @param word The word holding the group.
+ * @param grp The indexes of the group's `{` and `}`.
+ * @param alt The alternative to put in place of the group.
+ * @param len The length of the alternative.
+ * @return A newly allocated word (preamble, alternative and postscript), or
+ *         NULL if the allocation fails.
+ */
+char	*ft_brace_join(char *word, int *grp, char *alt, int len)
+{
+	char	*joined;
+	size_t	post;
+
+	post = ft_strlen(&word[grp[1] + 1]);
+	joined = (char *)malloc(grp[0] + len + post + 1);
+	if (!joined)
+		return (NULL);
+	ft_memcpy(joined, word, grp[0]);
+	ft_memcpy(joined + grp[0], alt, len);
+	ft_memcpy(joined + grp[0] + len, &word[grp[1] + 1], post + 1);
+	return (joined);
+}
+
+/**
+ * @brief Expands every alternative of a comma-separated brace group.
+ *
+ * Each alternative is joined with the preamble and postscript of the word
+ * and expanded again, so nested groups and following groups are handled
+ * one word at a time.
+ *
+ * @param word The word holding the group.
+ * @param grp The indexes of the group's `{` and `}`.
+ * @param br The brace expansion context holding the argument vector.
+ */
+static void	ft_brace_list(char *word, int *grp, t_brace *br)
+{
+	int		start;
+	int		end;
+	char	*next;
+
+	start = grp[0] + 1;
+	while (start <= grp[1])
+	{
+		end = ft_brace_scan(word, start, ',');
+		next = ft_brace_join(word, grp, &word[start], end - start);
+		if (!next)
+			return (ft_error_malloc("brace"));
+		ft_brace_expand(next, br);
+		free(next);
+		start = end + 1;
+	}
+}
+
+/**
+ * @brief Performs brace expansion on a word, writing the results to argv.
+ *
+ * The first expandable group of the word is replaced by each of its
+ * alternatives (or each element of its sequence) in turn, and every
+ * resulting word is expanded again until no group is left. Finished words
+ * are pushed straight into the argument vector (after wildcard expansion if
+ * the original token had one), so no intermediate list is ever built and
+ * memory stays proportional to the final argv. Words left empty by the
+ * expansion are dropped.
+ *
+ * @param word The word to expand.
+ * @param br The brace expansion context holding the argument vector.
+ */
+void	ft_brace_expand(char *word, t_brace *br)
+{
+	int	grp[2];
+
+	if (!*word)
+		return ;
+	if (!ft_brace_find(word, grp))
+		return (ft_argv_glob(br->argv, word, br->glob));
+	if (ft_brace_scan(word, grp[0] + 1, ',') != grp[1])
+		ft_brace_list(word, grp, br);
+	else
+		ft_brace_seq(word, grp, br);
+}
@@ -0,0 +1,178 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_brace_expansion_utils_bonus.c                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: joneves- <joneves-@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by joneves-          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by joneves-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell_bonus.h"
+
+/**
+ * @brief Parses an integer bound or increment of a sequence expression.
+ *
+ * A number with a leading zero (`01`, `-007`) asks for zero-padded output,
+ * so its length is recorded as the minimum width of the generated items.
+ *
+ * @param s The word holding the sequence.
+ * @param i Pointer to the index of the number, moved past it.
+ * @param n Receives the value of the number.
+ * @param width Pointer to the current item width, widened if needed.
+ * @return `true` if a number in the `int` range was read, `false` otherwise.
+ */
+static bool	ft_seq_number(char *s, int *i, long *n, int *width)
+{
+	int		start;
+	bool	padded;
+
+	start = *i;
+	if (s[*i] == '-')
+		(*i)++;
+	if (!ft_isdigit(s[*i]))
+		return (false);
+	padded = (s[*i] == '0' && ft_isdigit(s[*i + 1]));
+	*n = 0;
+	while (ft_isdigit(s[*i]))
+	{
+		if (*n > (INT_MAX - (s[*i] - '0')) / 10)
+			return (false);
+		*n = *n * 10 + s[(*i)++] - '0';
+	}
+	if (s[start] == '-')
+		*n = -*n;
+	if (padded && *i - start > *width)
+		*width = *i - start;
+	return (true);
+}
+
+/**
+ * @brief Parses a bound of a sequence, a number or a single letter.
+ *
+ * @param s The word holding the sequence.
+ * @param i Pointer to the index of the bound, moved past it.
+ * @param n Receives the value of the bound (the letter's code for letters).
+ * @param seq The sequence being parsed.
+ * @return `true` if a bound of the sequence's kind was read.
+ */
+static bool	ft_seq_bound(char *s, int *i, long *n, t_seq *seq)
+{
+	if (!seq->alpha)
+		return (ft_seq_number(s, i, n, &seq->width));
+	if (!ft_isalpha(s[*i]))
+		return (false);
+	*n = s[(*i)++];
+	return (true);
+}
+
+/**
+ * @brief Parses a sequence expression `{x..y}` or `{x..y..incr}`.
+ *
+ * Both bounds must be integers or both must be single letters; the optional
+ * increment is an integer whose sign is ignored. The step is oriented from
+ * the first bound towards the second one, and a null increment counts as 1.
+ *
+ * @param s The word holding the sequence.
+ * @param grp The indexes of the group's `{` and `}`.
+ * @param seq Receives the parsed sequence.
+ * @return `true` if the whole group is a valid sequence, `false` otherwise.
+ */
+bool	ft_seq_parse(char *s, int *grp, t_seq *seq)
+{
+	int	i;
+	int	pad;
+
+	i = grp[0] + 1;
+	ft_bzero(seq, sizeof(t_seq));
+	seq->alpha = ft_isalpha(s[i]);
+	if (!ft_seq_bound(s, &i, &seq->start, seq) || ft_strncmp(&s[i], "..", 2))
+		return (false);
+	i += 2;
+	if (!ft_seq_bound(s, &i, &seq->end, seq))
+		return (false);
+	pad = 0;
+	if (i + 2 < grp[1] && !ft_strncmp(&s[i], "..", 2))
+	{
+		i += 2;
+		if (!ft_seq_number(s, &i, &seq->step, &pad))
+			return (false);
+	}
+	if (seq->step < 0)
+		seq->step = -seq->step;
+	if (seq->step == 0)
+		seq->step = 1;
+	if (seq->start > seq->end)
+		seq->step = -seq->step;
+	return (i == grp[1]);
+}
+
+/**
+ * @brief Builds the text of one element of a sequence.
+ *
+ * @param seq The sequence being generated.
+ * @param n The value of the element.
+ * @return A newly allocated string holding the letter, or the number padded
+ *         with zeros to the sequence's width, or NULL on allocation failure.
+ */
+static char	*ft_seq_item(t_seq *seq, long n)
+{
+	char	*num;
+	char	*item;
+	int		neg;
+	int		len;
+
+	if (seq->alpha)
+		return (ft_charjoin(ft_strdup(""), (char)n));
+	num = ft_ltoa(n);
+	if (!num || (int)ft_strlen(num) >= seq->width)
+		return (num);
+	item = (char *)ft_calloc(seq->width + 1, sizeof(char));
+	if (!item)
+		return (free(num), NULL);
+	neg = (n < 0);
+	len = ft_strlen(num) - neg;
+	ft_memset(item, '0', seq->width);
+	if (neg)
+		item[0] = '-';
+	ft_memcpy(item + seq->width - len, num + neg, len);
+	return (free(num), item);
+}
+
+/**
+ * @brief Expands a sequence brace group, one element at a time.
+ *
+ * Elements are generated lazily from the parsed bounds: each one is joined
+ * with the preamble and postscript of the word and expanded again before the
+ * next one is built, so a `{1..1000000}` never exists as a list, only as the
+ * words it writes to the argument vector.
+ *
+ * @param word The word holding the group.
+ * @param grp The indexes of the group's `{` and `}`.
+ * @param br The brace expansion context holding the argument vector.
+ */
+void	ft_brace_seq(char *word, int *grp, t_brace *br)
+{
+	t_seq	seq;
+	long	n;
+	char	*item;
+	char	*next;
+
+	ft_seq_parse(word, grp, &seq);
+	n = seq.start;
+	while ((seq.step > 0 && n <= seq.end) || (seq.step < 0 && n >= seq.end))
+	{
+		item = ft_seq_item(&seq, n);
+		next = NULL;
+		if (item)
+			next = ft_brace_join(word, grp, item, ft_strlen(item));
+		free(item);
+		if (!next)
+			return (ft_error_malloc("brace"));
+		ft_brace_expand(next, br);
+		free(next);
+		n += seq.step;
+	}
+}
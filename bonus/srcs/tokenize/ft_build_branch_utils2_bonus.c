@@ -125,3 +125,42 @@ bool	ft_find_next_redir(t_list **list)
 	}
 	return (false);
 }
+
+/**
+ * @brief Moves the assignments in front of a command out of its arguments.
+ *
+ * Leading `EXPORT` and `EXPORT_AP` tokens followed by a command word are
+ * prefix assignments (`VAR=x cmd`): they only apply to the environment of
+ * that command, so they are kept in a list of their own and the node becomes
+ * an `EXEC` node. A node holding only assignments is left untouched.
+ *
+ * @param exec The execution node whose arguments are split.
+ * @return The list of prefix assignments (possibly empty), or NULL if the
+ *         allocation fails.
+ */
+t_list	**ft_split_assigns(t_exec *exec)
+{
+	t_list	**assigns;
+	t_list	*curr;
+	t_list	*last;
+
+	assigns = (t_list **)malloc(sizeof(t_list *));
+	if (!assigns)
+		return (ft_error_malloc("assigns"), NULL);
+	*assigns = NULL;
+	curr = *exec->args;
+	last = NULL;
+	while (curr && (((t_token *)curr->content)->type == EXPORT
+		|| ((t_token *)curr->content)->type == EXPORT_AP))
+	{
+		last = curr;
+		curr = curr->next;
+	}
+	if (!curr || !last)
+		return (assigns);
+	last->next = NULL;
+	*assigns = *exec->args;
+	*exec->args = curr;
+	exec->type = EXEC;
+	return (assigns);
+}
@@ -60,7 +60,8 @@ static t_list	**ft_get_args(t_list **list)
  * 
  * Allocates memory for an execution node, assigns its type, pathname, and
  * arguments, and processes subsequent tokens in the list until a pipe,
- * redirection, or NULL is encountered.
+ * redirection, or NULL is encountered. Assignments in front of a command
+ * (`VAR=x cmd`) are moved out of the arguments by `ft_split_assigns`.
  * 
  * @param token The current token representing the execution command.
  * @param list Pointer to the token list, updated as nodes are processed.
@@ -74,9 +75,13 @@ t_exec	*ft_create_exec_node(t_token *token, t_list **list)
 	if (!exec)
 		return (ft_error_malloc("exec"), NULL);
 	exec->type = token->type;
+	exec->expanded = false;
 	exec->args = ft_get_args(list);
 	if (!exec->args)
 		return (ft_error_malloc("exec->args"), NULL);
+	exec->assigns = ft_split_assigns(exec);
+	if (!exec->assigns)
+		return (NULL);
 	token = (*list)->content;
 	while (*list && (ft_is_token_type(token, EXEC)))
 	{
@@ -19,7 +19,8 @@
  * of type `AND` or `OR`. It returns `true` if such a token is found,indicating
  * that a logical operator has been encountered. If a token of type `PRTHESES`
  * (parentheses) is found, the search stops and the function returns `false`, 
- * indicating no logical operator is found before a parenthesis.
+ * indicating no logical operator is found before a parenthesis. A background
+ * operator (`&`) ends a list the same way and is reported as a root too.
  * 
  * @param list A pointer to the token list, which will be updated as the function
  *        iterates through it.
@@ -32,7 +33,7 @@ static bool	ft_find_next_root(t_list **list)
 	while (*list)
 	{
 		token = (t_token *)(*list)->content;
-		if (token->type == AND || token->type == OR)
+		if (token->type == AND || token->type == OR || token->type == BG)
 			return (true);
 		if (token->type == PRTHESES)
 			break ;
@@ -46,8 +47,8 @@ static bool	ft_find_next_root(t_list **list)
  * 
  * The function processes the token list to create a root node of type `t_node`.
  * It handles logical operators (`AND`, `OR`) and recursively builds left and 
- * right branches based on the tokens. It skips export tokens and appropriately
- * links child nodes to the root.
+ * right branches based on the tokens and appropriately links child nodes to
+ * the root. A root of type `BG` that ends the input has no left branch.
  * 
  * @param list A pointer to the token list that will be parsed.
  * @param node_type The type of the root node (logical operator or other).
@@ -58,8 +59,6 @@ void	*ft_build_root(t_list **list, t_type node_type)
 {
 	t_node	*root;
 
-	if (ft_validate_skip(list))
-		ft_skip_export_tokens(list);
 	root = (t_node *)malloc(sizeof(t_node));
 	if (!root)
 		return (ft_error_malloc("root"), NULL);
@@ -67,8 +66,10 @@ void	*ft_build_root(t_list **list, t_type node_type)
 	root->right = NULL;
 	root->parent_node = NULL;
 	root->type = node_type;
-	if (node_type == AND || node_type == OR)
+	if (node_type == AND || node_type == OR || node_type == BG)
 		*list = (*list)->next;
+	if (!*list)
+		return ((void *)root);
 	root->left = ft_build_tree(list, &root);
 	if (!root->left)
 		return ((void *)root);
@@ -12,71 +12,6 @@
 
 #include "../../includes/minishell_bonus.h"
 
-/**
- * @brief Validates whether the token list can skip export tokens or not.
- * 
- * This function checks if the given token list contains tokens to process for
- * execution, skipping over consecutive `EXPORT` or `EXPORT_AP` tokens. If 
- * `EXPORT` or `EXPORT_AP` tokens are followed by an `EXEC` token, the
- * validation to skip proceedes. If the list ends or if the first non-export
- * token is not an executable (`EXEC`) or if it is a node (`NODE`), it does not
- * skips the `EXPORT` and `EXPORT_AP` tokens.
- * 
- * @param list A double pointer to the token list to validate.
- * @return `true` if the list should skip until with a valid executable token,
- *         otherwise `false`.
- */
-bool	ft_validate_skip(t_list **list)
-{
-	t_token	*token;
-	t_list	*tmp;
-
-	tmp = *list;
-	token = tmp->content;
-	while (tmp && (token->type == EXPORT || token->type == EXPORT_AP))
-	{
-		tmp = tmp->next;
-		if (tmp)
-			token = tmp->content;
-	}
-	if (!tmp)
-		return (false);
-	if (ft_is_token_type(((t_token *)tmp->content), NODE)
-		|| !ft_is_token_type(((t_token *)tmp->content), EXEC))
-		return (false);
-	return (true);
-}
-
-/**
- * @brief skips consecutive `EXPORT` tokens in the list.
- * 
- * This function iterates through the token list, advancing the list pointer
- * as long as the current token is of type `EXPORT` or `EXPORT_AP`. It stops
- * when a non-EXPORT token is encountered or if the next token is invalid,
- * ensuring that the list points to a token that is not of these types before
- * proceeding.
- * 
- * @param list A pointer to the token list, which will be updated to skip over
- *        any `EXPORT` or `EXPORT_AP` tokens.
- */
-void	ft_skip_export_tokens(t_list **list)
-{
-	t_token	*token;
-
-	token = (*list)->content;
-	while (*list && (token->type == EXPORT || token->type == EXPORT_AP))
-	{
-		if (!((*list)->next)
-			|| ft_is_token_type(((t_token *)(*list)->next->content), NODE))
-			break ;
-		else
-		{
-			*list = (*list)->next;
-			token = (*list)->content;
-		}
-	}
-}
-
 /**
  * @brief Locates the next pipe token in the token list.
  * 
@@ -106,7 +41,7 @@ static bool	ft_find_next_pipe(t_list **list)
 			*list = (*list)->next;
 			return (true);
 		}
-		if (token->type == AND || token->type == OR)
+		if (token->type == AND || token->type == OR || token->type == BG)
 			return (false);
 		*list = (*list)->next;
 	}
@@ -133,8 +68,6 @@ void	*ft_build_tree(t_list **list, t_node **parent_node)
 {
 	t_node	*node;
 
-	if (ft_validate_skip(list))
-		ft_skip_export_tokens(list);
 	node = (t_node *)malloc(sizeof(t_node));
 	if (!node)
 		return (ft_error_malloc("node"), NULL);
@@ -52,29 +52,30 @@ static int	ft_handle_metachar(char **value, char *s, int i, t_list **list)
 }
 
 /**
- * @brief Handles quoted sections in the input, adding them to the token string
+ * @brief Handles quoted sections and braced expansions in the input, adding
+ *        them to the token string.
  * 
- * This function appends characters within a quoted section to `value`,
- * including the opening and closing quotes. It returns the updated index after
- * the closing quote.
+ * This function appends every character of the group starting at `s[i]`
+ * (a quoted section or a `${...}` expansion) to `value`, including the
+ * opening and closing characters. It returns the index of the closing
+ * character.
  * 
  * @param value Pointer to the string being built for the current token.
  * @param s Pointer to the input string.
  * @param i The current index in the input string.
- * @param quote The quote character (`'` or `"`).
- * @return Updated index after processing the quoted section.
+ * @return Index of the character that closes the group.
  */
-static int	ft_handle_quotes(char **value, char *s, int i, char quote)
+static int	ft_handle_group(char **value, char *s, int i)
 {
-	*value = ft_charjoin(*value, s[i]);
-	i++;
-	while (s[i] != quote)
+	int	end;
+
+	end = ft_skip_group(s, i);
+	while (i <= end)
 	{
 		*value = ft_charjoin(*value, s[i]);
 		i++;
 	}
-	*value = ft_charjoin(*value, s[i]);
-	return (i);
+	return (end);
 }
 
 /**
@@ -85,7 +86,8 @@ static int	ft_handle_quotes(char **value, char *s, int i, char quote)
  * The function:
  * - Detects and handles metacharacters and parentheses by delegating to
  *   `ft_handle_metachar`.
- * - Manages quoted substrings using `ft_handle_quotes`.
+ * - Manages quoted substrings and `${...}` expansions using
+ *   `ft_handle_group`.
  * - Stops processing if a comment character (`#`) is encountered after
  *   whitespace.
  * - Concatenates unprocessed characters into a token value using `ft_charjoin`.
@@ -106,10 +108,11 @@ static void	ft_process_tokens(char *s, t_list **token_list)
 	{
 		if (!ft_isspace(s[i]))
 		{
-			if (ft_strchr(METACHARS, s[i]) || ft_strchr(PRTHESESCHARS, s[i]))
+			if (ft_skip_group(s, i) > i)
+				i = ft_handle_group(&value, s, i);
+			else if (ft_strchr(METACHARS, s[i])
+				|| ft_strchr(PRTHESESCHARS, s[i]))
 				i = ft_handle_metachar(&value, &s[i], i, token_list);
-			else if (s[i] == SQUOTE || s[i] == DQUOTE)
-				i = ft_handle_quotes(&value, s, i, s[i]);
 			else if (s[i] == '#' && ft_isspace(s[i - 1]))
 				break ;
 			else
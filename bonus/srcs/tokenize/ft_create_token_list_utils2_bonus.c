@@ -38,13 +38,17 @@ bool	ft_is_heredoc_target(t_list **list)
 }
 
 /**
- * @brief Skips over a quoted substring in the input string.
+ * @brief Skips over a quoted substring or an expansion in the input string.
  * 
  * This function identifies and skips the content enclosed by single or 
  * double quotes starting at the given index `i`. It checks for invalid 
  * wildcard usage (`'*'`) inside single quotes or in double quotes unless 
  * prefixed by a `$`. If such a wildcard is found, the function returns `-1` 
- * to indicate invalid input.
+ * to indicate invalid input. A `${...}` or `$((...))` expansion starting at
+ * `i`, or nested in double quotes, is skipped as a whole, since a `*` inside
+ * it is not a wildcard: the end of a double-quoted section is found with
+ * `ft_find_next_quote`, so the quotes of a nested `"$(echo "*")"` do not end
+ * it early.
  * 
  * @param s The input string to analyze.
  * @param i The starting index to check for quoted substrings.
@@ -53,29 +57,24 @@ bool	ft_is_heredoc_target(t_list **list)
  */
 static int	ft_skip_quotes(char *s, int i)
 {
-	if (s[i] == SQUOTE)
+	char	quote;
+	int		end;
+
+	if (s[i] == '$')
+		return (ft_find_next_brace(s, i) + 1);
+	quote = s[i];
+	end = ft_find_next_quote(s, i, quote);
+	if (end == -1)
+		return (-1);
+	while (++i < end)
 	{
-		i++;
-		while (s[i] && s[i] != SQUOTE)
-		{
-			if (s[i] == '*')
-				return (-1);
-			i++;
-		}
-		i++;
+		if (quote == DQUOTE && s[i] == '$' && (s[i + 1] == '('
+				|| s[i + 1] == '{') && ft_find_next_brace(s, i) != -1)
+			i = ft_find_next_brace(s, i);
+		else if (s[i] == '*' && (quote == SQUOTE || s[i - 1] != '$'))
+			return (-1);
 	}
-	else if (s[i] == DQUOTE)
-	{
-		i++;
-		while (s[i] && s[i] != DQUOTE)
-		{
-			if (s[i] == '*' && s[i - 1] != '$')
-				return (-1);
-			i++;
-		}
-		i++;
-	}
-	return (i);
+	return (end + 1);
 }
 
 /**
@@ -103,22 +102,22 @@ bool	ft_is_wildcard(char *s)
 	wildcard = false;
 	while (s[i])
 	{
-		if (s[i] == SQUOTE || s[i] == DQUOTE)
+		if (s[i] == SQUOTE || s[i] == DQUOTE || (s[i] == '$'
+				&& (s[i + 1] == '{' || s[i + 1] == '(')
+				&& ft_find_next_brace(s, i) != -1))
 		{
 			i = ft_skip_quotes(s, i);
 			if (i == -1)
 				return (false);
 		}
-		else if ((i == 0 && s[i] == '*')
-			|| (i > 0 && s[i] == '*' && s[i - 1] != '$'))
-		{
-			wildcard = true;
-			i++;
-		}
 		else if (s[i] == '/')
 			return (false);
-		else if (s[i])
+		else
+		{
+			if (s[i] == '*' && (i == 0 || s[i - 1] != '$'))
+				wildcard = true;
 			i++;
+		}
 	}
 	return (wildcard);
 }
@@ -168,13 +167,20 @@ void	ft_validate_export_tokens(t_list **list)
  *
  * This function checks the given value for wildcard characters and expandable 
  * variables. It sets the `wildcard` and `expand` flags of the specified token 
- * accordingly.
+ * accordingly. Unquoted tokens holding a `{a,b}` or `{x..y}` group are also
+ * flagged for brace expansion, done later when the argv is built.
  *
  * @param new_token A pointer to the `t_token` structure to update.
  * @param value The string value to validate for wildcard and variable expansion
  */
 void	ft_validate_token_expansion(t_token *new_token, char *value)
 {
-	new_token->wildcard = ft_is_wildcard(value);
-	new_token->expand = ft_has_expandable_var(value);
+	int	grp[2];
+	int	list;
+
+	list = (ft_array_form(value) == ARRAY_LIST);
+	new_token->brace = (!list && new_token->state == GENERAL
+			&& ft_brace_find(value, grp));
+	new_token->wildcard = (!list && ft_is_wildcard(value));
+	new_token->expand = (!list && ft_has_expandable_var(value));
 }
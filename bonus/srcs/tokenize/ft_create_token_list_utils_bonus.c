@@ -18,7 +18,8 @@
  * 
  * This function checks if the token string represents an export with an append
  * (`+=`), a simple export (`=`), or an executable command. It identifies
- * command type based on the initial characters of `s`.
+ * command type based on the initial characters of `s`. A `[subscript]`
+ * following the name (an array element assignment) is skipped.
  * 
  * @param s The token string to check.
  * @return The command type: EXPORT_AP, EXPORT, or EXEC.
@@ -32,6 +33,8 @@ static t_type	ft_get_cmd_type(char *s)
 	{
 		while (ft_isalnum(s[i]) || s[i] == '_')
 			i++;
+		if (s[i] == '[' && ft_strchr(s + i, ']'))
+			i = ft_strchr(s + i, ']') - s + 1;
 		if (s[i] == '+' && s[i + 1] == '=')
 			return (EXPORT_AP);
 		else if (s[i] == '=')
@@ -65,14 +68,16 @@ static t_type	ft_get_token_type(char *s)
 		return (PIPE);
 	else if (s[0] == '>' && s[1] == '>')
 		return (APPEND);
-	else if (s[0] == '>')
+	else if (s[0] == '>' && s[1] != '(')
 		return (OUTFILE);
 	else if (s[0] == '<' && s[1] == '<')
 		return (HEREDOC);
-	else if (s[0] == '<')
+	else if (s[0] == '<' && s[1] != '(')
 		return (INFILE);
-	else if (s[0] == '&')
+	else if (s[0] == '&' && s[1] == '&')
 		return (AND);
+	else if (s[0] == '&')
+		return (BG);
 	else if (s[0] == '(' || s[0] == ')')
 		return (PRTHESES);
 	else
@@ -87,7 +92,8 @@ static t_type	ft_get_token_type(char *s)
  * 
  * This function scans through the token string to determine if it contains
  * single or double quotes. If so, it returns `IN_QUOTE`; otherwise, it returns
- * `GENERAL`.
+ * `GENERAL`. Quotes inside a `$(...)` command substitution belong to the
+ * substituted command and are ignored.
  * 
  * @param s The token string to examine.
  * @return The state of the token: IN_QUOTE or GENERAL.
@@ -101,6 +107,8 @@ static t_state	ft_get_token_state(char *s)
 	{
 		if (s[i] == SQUOTE || s[i] == DQUOTE)
 			return (IN_QUOTE);
+		if (s[i] == '$' && s[i + 1] == '(' && ft_find_next_brace(s, i) != -1)
+			i = ft_find_next_brace(s, i);
 		i++;
 	}
 	return (GENERAL);
@@ -136,7 +144,8 @@ bool	ft_has_expandable_var(char *s)
 				i++;
 			}
 		}
-		else if (s[i] == '$' && ft_is_expandable(&s[i + 1]))
+		else if ((s[i] == '$' && ft_is_expandable(&s[i + 1]))
+			|| ((s[i] == '<' || s[i] == '>') && s[i + 1] == '('))
 			return (true);
 		else if (s[i])
 			i++;
@@ -175,6 +184,7 @@ void	ft_add_to_token_list(char **value, t_list **token_list)
 	new_token->state = ft_get_token_state(*value);
 	new_token->wildcard = false;
 	new_token->expand = false;
+	new_token->brace = false;
 	if (token_list && !ft_is_heredoc_target(token_list))
 		ft_validate_token_expansion(new_token, *value);
 	new_node = ft_lstnew((t_token *)new_token);
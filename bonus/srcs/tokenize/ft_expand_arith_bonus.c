@@ -0,0 +1,133 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_expand_arith_bonus.c                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: joneves- <joneves-@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by joneves-          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by joneves-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell_bonus.h"
+
+/**
+ * @brief Reports an arithmetic error once per evaluation.
+ *
+ * Prints the expression, the error message and the remaining text (the
+ * token where evaluation stopped), marks the evaluation as failed and sets
+ * the exit status to 1. The shell's `expand_fail` is flagged too, so the
+ * command holding the expansion is not run. Later errors of the same
+ * evaluation are ignored.
+ *
+ * @param ar The arithmetic evaluation context.
+ * @param msg The error description.
+ */
+void	ft_arith_error(t_arith *ar, char *msg)
+{
+	if (ar->error)
+		return ;
+	ar->error = true;
+	ar->sh->expand_fail = true;
+	if (ar->expr[ar->pos])
+		ft_stderror(FALSE, ARITH_ERROR, ar->expr, msg, ar->expr + ar->pos);
+	else
+		ft_stderror(FALSE, ARITH_ERROR_S, ar->expr, msg);
+	ft_exit_status(1, TRUE, FALSE);
+}
+
+/**
+ * @brief Advances the evaluation context past any whitespace.
+ *
+ * @param ar The arithmetic evaluation context.
+ */
+void	ft_arith_skip_spaces(t_arith *ar)
+{
+	while (ft_isspace(ar->expr[ar->pos]))
+		ar->pos++;
+}
+
+/**
+ * @brief Evaluates an arithmetic expression.
+ *
+ * The expression is parsed and evaluated in a single pass by a recursive
+ * descent parser, with C operator precedence. An empty expression evaluates
+ * to 0. Variables referenced by name are looked up in the shell's variable
+ * stores and their values are evaluated as expressions themselves, up to
+ * `ARITH_MAX_DEPTH` levels deep.
+ *
+ * @param expr The null-terminated expression.
+ * @param sh A pointer to the shell structure holding the variable stores.
+ * @param depth The current recursion level (0 for a top-level expression).
+ * @param error Set to true if the evaluation fails.
+ * @return The value of the expression, or 0 on error.
+ */
+long	ft_arith_eval(char *expr, t_shell *sh, int depth, bool *error)
+{
+	t_arith	ar;
+	long	res;
+
+	ar.expr = expr;
+	ar.pos = 0;
+	ar.skip = 0;
+	ar.depth = depth;
+	ar.error = false;
+	ar.sh = sh;
+	res = 0;
+	ft_arith_skip_spaces(&ar);
+	if (expr[ar.pos])
+		res = ft_arith_comma(&ar);
+	ft_arith_skip_spaces(&ar);
+	if (!ar.error && expr[ar.pos])
+		ft_arith_error(&ar, ARITH_SYNTAX);
+	if (ar.error)
+		*error = true;
+	return (res);
+}
+
+/**
+ * @brief Expands a `$((...))` arithmetic expansion.
+ *
+ * The text between the double parentheses first undergoes parameter
+ * expansion and quote removal, and is then evaluated in-process by
+ * `ft_arith_eval`, so no `expr` process is forked. On error the expansion is
+ * empty, the exit status is set to 1 and the command holding the word is not
+ * run (see `ft_arith_error`). A `$((` without its closing `))` is
+ * kept as literal text, and one closed by `) )` is a command substitution
+ * starting with a subshell.
+ *
+ * @param value The string being expanded.
+ * @param i Pointer to the index of the first `(` in `value`. It is updated to
+ *        point past the closing parentheses.
+ * @param sh A pointer to the shell structure.
+ * @return The newly allocated expansion.
+ */
+char	*ft_expand_arith(char *value, int *i, t_shell *sh)
+{
+	char	*body;
+	char	*expr;
+	long	res;
+	int		end;
+	bool	error;
+
+	end = ft_find_next_brace(value, *i - 1);
+	if (end == -1)
+		return (ft_strdup("$"));
+	if (value[end - 1] != ')')
+		return (ft_expand_cmdsub(value, i, sh));
+	body = ft_substr(value, *i + 2, end - *i - 3);
+	*i = end + 1;
+	if (!body)
+		return (ft_error_malloc("body"), ft_strdup(""));
+	expr = ft_expand_word(body, sh, true);
+	free(body);
+	if (!expr)
+		return (ft_error_malloc("expr"), ft_strdup(""));
+	error = false;
+	res = ft_arith_eval(expr, sh, 0, &error);
+	free(expr);
+	if (error)
+		return (ft_strdup(""));
+	return (ft_ltoa(res));
+}
@@ -0,0 +1,179 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_expand_arith_utils2_bonus.c                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: joneves- <joneves-@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by joneves-          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by joneves-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell_bonus.h"
+
+/**
+ * @brief Matches a binary operator of the given precedence level.
+ *
+ * The operators of every level are listed in `ARITH_OPS`, from the lowest
+ * precedence to the highest, levels separated by `;`. An operator does not
+ * match when it is the start of a longer one (e.g. `&` in `&&`, `<` in
+ * `<<`, or `+` in `+=`). On success, the operator is copied into `op` and
+ * the context is advanced past it.
+ *
+ * @param ar The arithmetic evaluation context.
+ * @param level The precedence level, from 0 to `ARITH_LEVELS` - 1.
+ * @param op Buffer of at least 3 bytes receiving the matched operator.
+ * @return true if an operator of that level was found, false otherwise.
+ */
+static bool	ft_arith_match(t_arith *ar, int level, char *op)
+{
+	char	*ops;
+	char	*s;
+	int		len;
+
+	ops = ARITH_OPS;
+	while (level-- > 0)
+		ops = ft_strchr(ops, ';') + 1;
+	ft_arith_skip_spaces(ar);
+	s = ar->expr + ar->pos;
+	while (*ops && *ops != ';')
+	{
+		len = 0;
+		while (ops[len] && ops[len] != ' ' && ops[len] != ';')
+			len++;
+		if (!ft_strncmp(s, ops, len) && s[len] != '='
+			&& !(len == 1 && s[1] == s[0]))
+		{
+			ft_strlcpy(op, ops, len + 1);
+			ar->pos += len;
+			return (true);
+		}
+		ops += len + (ops[len] == ' ');
+	}
+	return (false);
+}
+
+/**
+ * @brief Applies an arithmetic or shift operator.
+ *
+ * Addition, subtraction, multiplication and left shifts wrap around instead
+ * of overflowing, and dividing the smallest value by -1 does not trap.
+ *
+ * @param op The operator.
+ * @param a The left operand.
+ * @param b The right operand (never 0 for `/` and `%`).
+ * @return The result of the operation.
+ */
+static long	ft_arith_math(char *op, long a, long b)
+{
+	if (op[0] == '+')
+		return ((long)((unsigned long)a + (unsigned long)b));
+	if (op[0] == '-')
+		return ((long)((unsigned long)a - (unsigned long)b));
+	if (op[0] == '*')
+		return ((long)((unsigned long)a * (unsigned long)b));
+	if (op[0] == '/' && b == -1)
+		return ((long)(0UL - (unsigned long)a));
+	if (op[0] == '/')
+		return (a / b);
+	if (op[0] == '%' && b == -1)
+		return (0);
+	if (op[0] == '%')
+		return (a % b);
+	if (op[0] == '<')
+		return ((long)((unsigned long)a << (b & 63)));
+	return (a >> (b & 63));
+}
+
+/**
+ * @brief Applies a logical, comparison or bitwise operator.
+ *
+ * @param op The operator.
+ * @param a The left operand.
+ * @param b The right operand.
+ * @return The result of the operation (0 or 1 for logic and comparisons).
+ */
+static long	ft_arith_logic(char *op, long a, long b)
+{
+	if (!ft_strcmp(op, "&&"))
+		return (a && b);
+	if (!ft_strcmp(op, "||"))
+		return (a || b);
+	if (!ft_strcmp(op, "=="))
+		return (a == b);
+	if (!ft_strcmp(op, "!="))
+		return (a != b);
+	if (!ft_strcmp(op, "<="))
+		return (a <= b);
+	if (!ft_strcmp(op, ">="))
+		return (a >= b);
+	if (!ft_strcmp(op, "<"))
+		return (a < b);
+	if (!ft_strcmp(op, ">"))
+		return (a > b);
+	if (!ft_strcmp(op, "&"))
+		return (a & b);
+	if (!ft_strcmp(op, "|"))
+		return (a | b);
+	return (a ^ b);
+}
+
+/**
+ * @brief Applies a binary operator to two operands.
+ *
+ * Division and remainder by zero are reported as errors, unless the context
+ * is in skip mode (the operands belong to a branch that is not evaluated).
+ *
+ * @param ar The arithmetic evaluation context.
+ * @param op The operator.
+ * @param a The left operand.
+ * @param b The right operand.
+ * @return The result of the operation, or 0 on error.
+ */
+long	ft_arith_apply(t_arith *ar, char *op, long a, long b)
+{
+	if ((op[0] == '/' || op[0] == '%') && b == 0)
+	{
+		if (!ar->skip)
+			ft_arith_error(ar, ARITH_DIV_ZERO);
+		return (0);
+	}
+	if (ft_strchr("+-*/%", op[0])
+		|| ((op[0] == '<' || op[0] == '>') && op[1] == op[0]))
+		return (ft_arith_math(op, a, b));
+	return (ft_arith_logic(op, a, b));
+}
+
+/**
+ * @brief Evaluates binary operators from a precedence level upwards.
+ *
+ * Operators of the same level are left associative. The right operand of
+ * `&&` and `||` is evaluated in skip mode when the left operand already
+ * decides the result, so its side effects are not performed.
+ *
+ * @param ar The arithmetic evaluation context.
+ * @param level The lowest precedence level to handle.
+ * @return The value of the expression.
+ */
+long	ft_arith_binary(t_arith *ar, int level)
+{
+	long	left;
+	long	right;
+	char	op[4];
+	int		shortcut;
+
+	if (level == ARITH_LEVELS)
+		return (ft_arith_unary(ar));
+	left = ft_arith_binary(ar, level + 1);
+	while (!ar->error && ft_arith_match(ar, level, op))
+	{
+		shortcut = ((!ft_strcmp(op, "&&") && !left)
+				|| (!ft_strcmp(op, "||") && left));
+		ar->skip += shortcut;
+		right = ft_arith_binary(ar, level + 1);
+		ar->skip -= shortcut;
+		left = ft_arith_apply(ar, op, left, right);
+	}
+	return (left);
+}
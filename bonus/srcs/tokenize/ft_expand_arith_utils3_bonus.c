@@ -0,0 +1,140 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_expand_arith_utils3_bonus.c                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: joneves- <joneves-@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by joneves-          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by joneves-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell_bonus.h"
+
+/**
+ * @brief Converts a digit character to its value.
+ *
+ * @param c The digit (`0-9`, `a-z` or `A-Z`).
+ * @return The value of the digit, or `INT_MAX` if `c` is not a digit.
+ */
+static int	ft_arith_digit(char c)
+{
+	if (ft_isdigit(c))
+		return (c - '0');
+	if (c >= 'a' && c <= 'z')
+		return (c - 'a' + 10);
+	if (c >= 'A' && c <= 'Z')
+		return (c - 'A' + 10);
+	return (INT_MAX);
+}
+
+/**
+ * @brief Parses an integer constant.
+ *
+ * Constants starting with `0x` or `0X` are hexadecimal, other constants
+ * starting with `0` are octal and the remaining ones are decimal. A digit
+ * that is not valid in the constant's base is an error.
+ *
+ * @param ar The arithmetic evaluation context, positioned at the constant.
+ * @return The value of the constant, or 0 on error.
+ */
+static long	ft_arith_number(t_arith *ar)
+{
+	unsigned long	res;
+	int				base;
+	int				digit;
+
+	base = 10;
+	if (ar->expr[ar->pos] == '0' && (ar->expr[ar->pos + 1] == 'x'
+			|| ar->expr[ar->pos + 1] == 'X'))
+	{
+		base = 16;
+		ar->pos += 2;
+	}
+	else if (ar->expr[ar->pos] == '0')
+		base = 8;
+	res = 0;
+	while (ft_isalnum(ar->expr[ar->pos]) || ar->expr[ar->pos] == '_')
+	{
+		digit = ft_arith_digit(ar->expr[ar->pos]);
+		if (digit >= base)
+			return (ft_arith_error(ar, ARITH_BASE), 0);
+		res = res * base + digit;
+		ar->pos++;
+	}
+	return ((long)res);
+}
+
+/**
+ * @brief Evaluates a primary expression.
+ *
+ * A primary expression is a parenthesized expression, an integer constant
+ * or a variable reference (optionally followed by `++` or `--`).
+ *
+ * @param ar The arithmetic evaluation context.
+ * @return The value of the expression, or 0 on error.
+ */
+static long	ft_arith_primary(t_arith *ar)
+{
+	long	val;
+	char	c;
+
+	ft_arith_skip_spaces(ar);
+	c = ar->expr[ar->pos];
+	if (c == '(')
+	{
+		ar->pos++;
+		val = ft_arith_comma(ar);
+		ft_arith_skip_spaces(ar);
+		if (ar->expr[ar->pos] != ')')
+			return (ft_arith_error(ar, ARITH_PRTHESES), 0);
+		ar->pos++;
+	}
+	else if (ft_isdigit(c))
+		val = ft_arith_number(ar);
+	else if (ft_isalpha(c) || c == '_')
+		val = ft_arith_variable(ar);
+	else
+		return (ft_arith_error(ar, ARITH_OPERAND), 0);
+	ft_arith_skip_spaces(ar);
+	return (val);
+}
+
+/**
+ * @brief Evaluates a unary expression.
+ *
+ * Handles the prefix operators `++` and `--` (which require a variable
+ * name), unary `+`, `-`, logical negation `!` and bitwise negation `~`.
+ *
+ * @param ar The arithmetic evaluation context.
+ * @return The value of the expression, or 0 on error.
+ */
+long	ft_arith_unary(t_arith *ar)
+{
+	long	val;
+	int		start;
+	char	c;
+
+	ft_arith_skip_spaces(ar);
+	c = ar->expr[ar->pos];
+	if ((c == '+' || c == '-') && ar->expr[ar->pos + 1] == c)
+	{
+		ar->pos += 2;
+		ft_arith_skip_spaces(ar);
+		start = ar->pos;
+		ar->pos += ft_arith_namelen(ar->expr + start);
+		return (ft_arith_incdec(ar, start, c, true));
+	}
+	if (!c || !ft_strchr("+-!~", c))
+		return (ft_arith_primary(ar));
+	ar->pos++;
+	val = ft_arith_unary(ar);
+	if (c == '-')
+		return ((long)(0UL - (unsigned long)val));
+	if (c == '!')
+		return (!val);
+	if (c == '~')
+		return (~val);
+	return (val);
+}
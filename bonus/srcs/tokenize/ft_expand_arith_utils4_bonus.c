@@ -0,0 +1,147 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_expand_arith_utils4_bonus.c                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: joneves- <joneves-@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by joneves-          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by joneves-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell_bonus.h"
+
+/**
+ * @brief Measures the variable name at the start of a string.
+ *
+ * @param s The string.
+ * @return The length of the name, or 0 if `s` does not start with a name.
+ */
+int	ft_arith_namelen(char *s)
+{
+	int	len;
+
+	if (!ft_isalpha(s[0]) && s[0] != '_')
+		return (0);
+	len = 1;
+	while (ft_isalnum(s[len]) || s[len] == '_')
+		len++;
+	return (len);
+}
+
+/**
+ * @brief Retrieves the numeric value of a variable.
+ *
+ * Unset and empty variables evaluate to 0. Any other value is evaluated as
+ * an arithmetic expression of its own, as long as the recursion limit is
+ * not reached.
+ *
+ * @param ar The arithmetic evaluation context.
+ * @param name Pointer to the variable name (not null-terminated).
+ * @param len The length of the name.
+ * @return The value of the variable, or 0 on error.
+ */
+long	ft_arith_lookup(t_arith *ar, char *name, int len)
+{
+	char	*value;
+	long	res;
+
+	if (ar->error)
+		return (0);
+	value = ft_getvar(name, len, ar->sh);
+	if (!value || !*value)
+		return (0);
+	if (ar->depth >= ARITH_MAX_DEPTH)
+		return (ft_arith_error(ar, ARITH_RECURSION), 0);
+	value = ft_strdup(value);
+	if (!value)
+		return (ft_error_malloc("value"), 0);
+	res = ft_arith_eval(value, ar->sh, ar->depth + 1, &ar->error);
+	free(value);
+	return (res);
+}
+
+/**
+ * @brief Assigns a numeric value to a shell variable.
+ *
+ * Nothing is stored while the context is in skip mode or after an error.
+ *
+ * @param ar The arithmetic evaluation context.
+ * @param name Pointer to the variable name (not null-terminated).
+ * @param len The length of the name.
+ * @param value The value to assign.
+ * @return The assigned value.
+ */
+long	ft_arith_store(t_arith *ar, char *name, int len, long value)
+{
+	char	*key;
+	char	*str;
+
+	if (ar->skip || ar->error)
+		return (value);
+	key = ft_substr(name, 0, len);
+	str = ft_ltoa(value);
+	if (key && str)
+		ft_assign_param(key, str, ar->sh);
+	else
+		ft_error_malloc("ft_arith_store");
+	free(key);
+	free(str);
+	return (value);
+}
+
+/**
+ * @brief Applies a `++` or `--` operator to a variable.
+ *
+ * @param ar The arithmetic evaluation context.
+ * @param start The index of the variable name in the expression.
+ * @param c `+` for an increment or `-` for a decrement.
+ * @param prefix true for `++name`, false for `name++`.
+ * @return The new value for the prefix form, the old value otherwise.
+ */
+long	ft_arith_incdec(t_arith *ar, int start, char c, bool prefix)
+{
+	long	old;
+	long	new;
+	int		len;
+
+	len = ft_arith_namelen(ar->expr + start);
+	if (!len)
+		return (ft_arith_error(ar, ARITH_OPERAND), 0);
+	old = ft_arith_lookup(ar, ar->expr + start, len);
+	if (c == '+')
+		new = (long)((unsigned long)old + 1);
+	else
+		new = (long)((unsigned long)old - 1);
+	ft_arith_store(ar, ar->expr + start, len, new);
+	ft_arith_skip_spaces(ar);
+	if (prefix)
+		return (new);
+	return (old);
+}
+
+/**
+ * @brief Evaluates a variable reference, with an optional `++` or `--`.
+ *
+ * @param ar The arithmetic evaluation context, positioned at the name.
+ * @return The value of the variable (before the postfix operator, if any).
+ */
+long	ft_arith_variable(t_arith *ar)
+{
+	int		start;
+	int		len;
+	char	c;
+
+	start = ar->pos;
+	len = ft_arith_namelen(ar->expr + start);
+	ar->pos += len;
+	ft_arith_skip_spaces(ar);
+	c = ar->expr[ar->pos];
+	if ((c == '+' || c == '-') && ar->expr[ar->pos + 1] == c)
+	{
+		ar->pos += 2;
+		return (ft_arith_incdec(ar, start, c, false));
+	}
+	return (ft_arith_lookup(ar, ar->expr + start, len));
+}
@@ -0,0 +1,136 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_expand_arith_utils_bonus.c                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: joneves- <joneves-@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by joneves-          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by joneves-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell_bonus.h"
+
+/**
+ * @brief Recognizes an assignment operator.
+ *
+ * Accepts `=`, `+=`, `-=`, `*=`, `/=`, `%=`, `&=`, `^=`, `|=`, `<<=` and
+ * `>>=`. For compound operators, the binary operator to apply before the
+ * assignment is copied into `op`; for a plain assignment `op` is set to `=`.
+ *
+ * @param s Pointer to the text following the variable name.
+ * @param op Buffer of at least 3 bytes receiving the operator.
+ * @return The length of the assignment operator, or 0 if there is none.
+ */
+static int	ft_arith_assign_op(char *s, char *op)
+{
+	int	len;
+
+	len = 0;
+	if ((s[0] == '<' || s[0] == '>') && s[1] == s[0])
+		len = 2;
+	else if (s[0] && ft_strchr("+-*/%&^|", s[0]))
+		len = 1;
+	if (s[len] != '=' || (len == 0 && s[1] == '='))
+		return (0);
+	if (len == 0)
+		ft_strlcpy(op, "=", 2);
+	else
+		ft_strlcpy(op, s, len + 1);
+	return (len + 1);
+}
+
+/**
+ * @brief Evaluates a conditional expression (`cond ? a : b`).
+ *
+ * Only the selected branch has side effects: the other one is parsed with
+ * the context in skip mode, so assignments and increments in it are not
+ * performed and divisions by zero are not reported.
+ *
+ * @param ar The arithmetic evaluation context.
+ * @return The value of the selected branch.
+ */
+static long	ft_arith_ternary(t_arith *ar)
+{
+	long	cond;
+	long	first;
+	long	second;
+
+	cond = ft_arith_binary(ar, 0);
+	if (ar->error || ar->expr[ar->pos] != '?')
+		return (cond);
+	ar->pos++;
+	ar->skip += (cond == 0);
+	first = ft_arith_assign(ar);
+	ar->skip -= (cond == 0);
+	ft_arith_skip_spaces(ar);
+	if (ar->error || ar->expr[ar->pos] != ':')
+		return (ft_arith_error(ar, ARITH_COLON), 0);
+	ar->pos++;
+	ar->skip += (cond != 0);
+	second = ft_arith_ternary(ar);
+	ar->skip -= (cond != 0);
+	if (cond)
+		return (first);
+	return (second);
+}
+
+/**
+ * @brief Evaluates an assignment expression (`name op= expr`).
+ *
+ * If the expression starts with a variable name followed by an assignment
+ * operator, the right-hand side is evaluated (assignments are right
+ * associative), combined with the current value for compound operators and
+ * stored in the shell variables. Otherwise the expression is evaluated as a
+ * conditional expression.
+ *
+ * @param ar The arithmetic evaluation context.
+ * @return The assigned value, or the value of the conditional expression.
+ */
+long	ft_arith_assign(t_arith *ar)
+{
+	char	op[4];
+	int		start;
+	int		len;
+	long	rhs;
+
+	ft_arith_skip_spaces(ar);
+	start = ar->pos;
+	len = ft_arith_namelen(ar->expr + start);
+	ar->pos += len;
+	ft_arith_skip_spaces(ar);
+	if (len && ft_arith_assign_op(ar->expr + ar->pos, op))
+	{
+		ar->pos += ft_arith_assign_op(ar->expr + ar->pos, op);
+		rhs = ft_arith_assign(ar);
+		if (op[0] != '=')
+			rhs = ft_arith_apply(ar, op, \
+				ft_arith_lookup(ar, ar->expr + start, len), rhs);
+		return (ft_arith_store(ar, ar->expr + start, len, rhs));
+	}
+	ar->pos = start;
+	return (ft_arith_ternary(ar));
+}
+
+/**
+ * @brief Evaluates a comma-separated list of expressions.
+ *
+ * Every expression is evaluated in order; the value of the last one is the
+ * value of the list.
+ *
+ * @param ar The arithmetic evaluation context.
+ * @return The value of the last expression.
+ */
+long	ft_arith_comma(t_arith *ar)
+{
+	long	val;
+
+	val = ft_arith_assign(ar);
+	while (!ar->error && ar->expr[ar->pos] == ',')
+	{
+		ar->pos++;
+		val = ft_arith_assign(ar);
+	}
+	return (val);
+}
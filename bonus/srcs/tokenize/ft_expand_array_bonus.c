@@ -0,0 +1,158 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_expand_array_bonus.c                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: joneves- <joneves-@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by joneves-          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by joneves-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell_bonus.h"
+
+/**
+ * @brief Extracts the subscript of a `name[subscript]` parameter.
+ *
+ * @param body The parameter, starting with its name.
+ * @param len The length of the name; `body[len]` is the `[`.
+ * @param end Receives the index of the closing `]`.
+ * @return The newly allocated subscript, or NULL if the `]` is missing.
+ */
+static char	*ft_array_subscript(char *body, int len, int *end)
+{
+	char	*close;
+	char	*sub;
+
+	close = ft_strchr(body + len, ']');
+	if (!close)
+		return (NULL);
+	*end = close - body;
+	sub = ft_substr(body, len + 1, *end - len - 1);
+	if (!sub)
+		return (ft_error_malloc("sub"), NULL);
+	return (sub);
+}
+
+/**
+ * @brief Checks whether a subscript stands for every element of an array.
+ *
+ * @param sub The subscript.
+ * @return `true` for the `@` and `*` subscripts, `false` otherwise.
+ */
+static bool	ft_array_all(char *sub)
+{
+	return (!ft_strcmp(sub, "@") || !ft_strcmp(sub, "*"));
+}
+
+/**
+ * @brief Looks up the value of `name[subscript]`.
+ *
+ * The `@` and `*` subscripts expand to every value of the array, joined by
+ * spaces. Other subscripts are expanded and then looked up. A name that is
+ * not an array behaves as a one-element array.
+ *
+ * @param body The parameter, starting with its name.
+ * @param len The length of the name.
+ * @param sub The subscript.
+ * @param sh A pointer to the shell structure.
+ * @return The newly allocated value, or NULL if it is not set.
+ */
+static char	*ft_array_lookup(char *body, int len, char *sub, t_shell *sh)
+{
+	t_array	*arr;
+	char	*key;
+	char	*value;
+
+	arr = ft_array_find(body, len, sh);
+	if (!arr)
+	{
+		value = ft_getvar(body, len, sh);
+		if (!value)
+			return (NULL);
+		return (ft_strdup(value));
+	}
+	if (ft_array_all(sub))
+		return (ft_array_join(arr, ' '));
+	key = ft_expand_word(sub, sh, true);
+	value = NULL;
+	if (key)
+		value = ft_array_get(arr, key, sh);
+	free(key);
+	if (!value)
+		return (NULL);
+	return (ft_strdup(value));
+}
+
+/**
+ * @brief Expands a `${name[subscript]...}` parameter.
+ *
+ * The value of the element (or of all elements) then goes through the same
+ * operators as any other parameter (`:-`, `#`, `/`, ...). For `@`, the
+ * elements are also recorded by `ft_array_fields`, so that a quoted
+ * `"${name[@]}"` gives one field per element.
+ *
+ * @param body The text between the braces, starting with the name.
+ * @param len The length of the name; `body[len]` is the `[`.
+ * @param sh A pointer to the shell structure.
+ * @return The newly allocated expansion, or NULL on a bad substitution.
+ */
+char	*ft_array_expand(char *body, int len, t_shell *sh)
+{
+	char	*sub;
+	char	*name;
+	char	*value;
+	char	*res;
+	int		end;
+
+	sub = ft_array_subscript(body, len, &end);
+	if (!sub)
+		return (NULL);
+	value = ft_array_lookup(body, len, sub, sh);
+	if (!ft_strcmp(sub, "@"))
+		ft_array_fields(body, len, value, sh);
+	free(sub);
+	name = ft_substr(body, 0, len);
+	if (!name)
+		return (free(value), ft_error_malloc("name"), NULL);
+	res = ft_param_operator(value, name, body + end + 1, sh);
+	free(name);
+	return (res);
+}
+
+/**
+ * @brief Expands a `${#name[subscript]}` parameter.
+ *
+ * With `@` or `*`, this is the number of elements set in the array;
+ * otherwise, the length of the element.
+ *
+ * @param s The text after the `#`, starting with the name.
+ * @param len The length of the name; `s[len]` is the `[`.
+ * @param sh A pointer to the shell structure.
+ * @return The newly allocated length, or NULL on a bad substitution.
+ */
+char	*ft_array_length(char *s, int len, t_shell *sh)
+{
+	t_array	*arr;
+	char	*sub;
+	char	*value;
+	size_t	count;
+	int		end;
+
+	sub = ft_array_subscript(s, len, &end);
+	if (!sub || s[end + 1])
+		return (free(sub), NULL);
+	arr = ft_array_find(s, len, sh);
+	value = NULL;
+	if (ft_array_all(sub) && arr)
+		count = arr->count + arr->map.count;
+	else
+	{
+		value = ft_array_lookup(s, len, sub, sh);
+		count = ft_strlen(value);
+		if (ft_array_all(sub))
+			count = (value != NULL);
+	}
+	return (free(value), free(sub), ft_itoa(count));
+}
@@ -0,0 +1,155 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_expand_braces_bonus.c                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: joneves- <joneves-@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by joneves-          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by joneves-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell_bonus.h"
+
+/**
+ * @brief Measures the parameter name at the start of a braced expansion.
+ *
+ * A name is either the special parameter `?` or a sequence of alphanumeric
+ * characters and underscores.
+ *
+ * @param s Pointer to the start of the parameter name.
+ * @return The length of the name, or 0 if `s` does not start with a name.
+ */
+static int	ft_param_namelen(char *s)
+{
+	int	len;
+
+	if (s[0] == '?')
+		return (1);
+	len = 0;
+	while (ft_isalnum(s[len]) || s[len] == '_')
+		len++;
+	return (len);
+}
+
+/**
+ * @brief Retrieves the value of a parameter as a newly allocated string.
+ *
+ * @param name Pointer to the parameter name (not null-terminated).
+ * @param len Length of the parameter name.
+ * @param sh A pointer to the shell structure holding the variable stores.
+ * @return A copy of the value, or NULL if the parameter is not set.
+ */
+static char	*ft_param_value(char *name, int len, t_shell *sh)
+{
+	char	*value;
+
+	if (name[0] == '?')
+		return (ft_itoa(ft_exit_status(0, FALSE, FALSE)));
+	value = ft_getvar(name, len, sh);
+	if (!value)
+		return (NULL);
+	return (ft_strdup(value));
+}
+
+/**
+ * @brief Expands `${#name}` to the length of the parameter's value.
+ *
+ * `${#name[subscript]}` is handed to `ft_array_length`.
+ *
+ * @param s Pointer to the parameter name, right after the `#`.
+ * @param sh A pointer to the shell structure.
+ * @return The length in string format, or NULL if `s` is not a plain name.
+ */
+static char	*ft_param_length(char *s, t_shell *sh)
+{
+	char	*value;
+	char	*res;
+	int		len;
+
+	len = ft_param_namelen(s);
+	if (len && s[len] == '[')
+		return (ft_array_length(s, len, sh));
+	if (!len || s[len])
+		return (NULL);
+	value = ft_param_value(s, len, sh);
+	res = ft_itoa(ft_strlen(value));
+	free(value);
+	return (res);
+}
+
+/**
+ * @brief Expands `${name}` or `${name<op>...}`.
+ *
+ * Reads the parameter name, fetches its value and hands both to
+ * `ft_param_operator`, which applies the operator that follows the name.
+ * A name followed by a subscript is expanded by `ft_array_expand`.
+ *
+ * @param body The text between the braces.
+ * @param sh A pointer to the shell structure.
+ * @return The expanded value, or NULL if the expansion is not supported.
+ */
+static char	*ft_param_expand(char *body, t_shell *sh)
+{
+	char	*name;
+	char	*res;
+	int		len;
+
+	len = ft_param_namelen(body);
+	if (!len)
+		return (NULL);
+	if (body[len] == '[')
+		return (ft_array_expand(body, len, sh));
+	name = ft_substr(body, 0, len);
+	if (!name)
+		return (ft_error_malloc("name"), NULL);
+	res = ft_param_operator(ft_param_value(name, len, sh), name, \
+		body + len, sh);
+	free(name);
+	return (res);
+}
+
+/**
+ * @brief Expands a `${...}` parameter expansion.
+ *
+ * Supports `${name}`, `${#name}`, `${name:-word}`, `${name:=word}`,
+ * `${name#pat}`, `${name##pat}`, `${name%pat}`, `${name%%pat}`,
+ * `${name/pat/rep}`, `${name//pat/rep}` and `${name:off:len}`, all evaluated
+ * inside the shell. Unsupported forms print a "bad substitution" error, set
+ * the exit status to 1 and expand to an empty string, and flag the shell's
+ * `expand_fail` so the command holding the word is not run. An unclosed
+ * `${` is kept as literal text.
+ *
+ * @param value The string being expanded.
+ * @param i Pointer to the index of the `{` in `value`. It is updated to point
+ *        past the closing brace.
+ * @param sh A pointer to the shell structure.
+ * @return The newly allocated expansion.
+ */
+char	*ft_expand_braces(char *value, int *i, t_shell *sh)
+{
+	char	*body;
+	char	*res;
+	int		end;
+
+	end = ft_find_next_brace(value, *i - 1);
+	if (end == -1)
+		return (ft_strdup("$"));
+	body = ft_substr(value, *i + 1, end - *i - 1);
+	*i = end + 1;
+	if (!body)
+		return (ft_error_malloc("body"), ft_strdup(""));
+	if (body[0] == '#' && body[1])
+		res = ft_param_length(body + 1, sh);
+	else
+		res = ft_param_expand(body, sh);
+	if (!res)
+	{
+		sh->expand_fail = true;
+		return (ft_stderror(FALSE, BAD_SUBSTITUTION, body), \
+			ft_exit_status(1, TRUE, FALSE), free(body), ft_strdup(""));
+	}
+	free(body);
+	return (res);
+}
@@ -0,0 +1,187 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_expand_braces_utils2_bonus.c                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: joneves- <joneves-@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by joneves-          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by joneves-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell_bonus.h"
+
+/**
+ * @brief Parses the offset or length of a substring expansion.
+ *
+ * Like `ft_atoi`, leading spaces and one sign are accepted and parsing stops
+ * at the first non-digit, but the value is a `long long` that saturates
+ * instead of overflowing, so a huge number selects nothing rather than
+ * wrapping around to a valid index.
+ *
+ * @param s The text to parse.
+ * @return The parsed value.
+ */
+static long long	ft_param_number(const char *s)
+{
+	long long	n;
+	int			sign;
+
+	n = 0;
+	sign = 1;
+	while (ft_isspace(*s))
+		s++;
+	if (*s == '-')
+		sign = -1;
+	if (*s == '-' || *s == '+')
+		s++;
+	while (ft_isdigit(*s))
+	{
+		if (n > (LLONG_MAX - (*s - '0')) / 10)
+			return (LLONG_MAX * sign);
+		n = n * 10 + (*s++ - '0');
+	}
+	return (n * sign);
+}
+
+/**
+ * @brief Normalizes the offset and length of a substring expansion.
+ *
+ * A negative offset counts from the end of the value and a negative length
+ * is taken as an offset from the end of the value, as in bash. An offset
+ * outside the value selects nothing, and a length reaching past its end is
+ * cut at the end.
+ *
+ * @param off Pointer to the offset to be normalized.
+ * @param len Pointer to the length to be normalized.
+ * @param size Length of the value.
+ * @return 1 if the resulting range is not empty, 0 if it is empty, or -1 if
+ *         a negative length ends before the offset.
+ */
+static int	ft_clamp_range(long long *off, long long *len, long long size)
+{
+	if (*off < 0)
+		*off += size;
+	if (*off < 0 || *off > size)
+		return (0);
+	if (*len < 0)
+		*len = size - *off + *len;
+	if (*len < 0)
+		return (-1);
+	if (*len > size - *off)
+		*len = size - *off;
+	return (*len > 0);
+}
+
+/**
+ * @brief Expands `${name:off}` and `${name:off:len}`.
+ *
+ * @param val The current value of the parameter. It is freed.
+ * @param spec Pointer to the offset, optionally followed by `:len`.
+ * @param sh A pointer to the shell structure.
+ * @return The newly allocated substring, or NULL if the expansion is a bad
+ *         substitution.
+ */
+char	*ft_param_substr(char *val, char *spec, t_shell *sh)
+{
+	char		*word;
+	char		*colon;
+	long long	off;
+	long long	len;
+	int			range;
+
+	word = ft_expand_word(spec, sh, true);
+	if (!word)
+		return (free(val), NULL);
+	off = ft_param_number(word);
+	len = ft_strlen(val);
+	colon = ft_strchr(word, ':');
+	if (colon)
+		len = ft_param_number(colon + 1);
+	free(word);
+	range = ft_clamp_range(&off, &len, ft_strlen(val));
+	if (range < 0)
+		return (free(val), NULL);
+	if (range == 0)
+		return (free(val), ft_strdup(""));
+	word = ft_substr(val, off, len);
+	free(val);
+	return (word);
+}
+
+/**
+ * @brief Expands `${name#pat}`, `${name##pat}`, `${name%pat}` and
+ *        `${name%%pat}`.
+ *
+ * The shortest (or, when the operator is doubled, the longest) prefix or
+ * suffix matching the pattern is removed from the value in place.
+ *
+ * @param val The current value of the parameter. It is returned after being
+ *        trimmed.
+ * @param op Pointer to the operator followed by the pattern.
+ * @param sh A pointer to the shell structure.
+ * @return The trimmed value.
+ */
+char	*ft_param_trim(char *val, char *op, t_shell *sh)
+{
+	char	*pat;
+	bool	longest;
+	int		k;
+
+	longest = (op[1] == op[0]);
+	pat = ft_expand_word(op + 1 + longest, sh, true);
+	if (!pat)
+		return (val);
+	if (op[0] == '#')
+	{
+		k = ft_match_head(pat, val, longest);
+		if (k > 0)
+			ft_memmove(val, val + k, ft_strlen(val + k) + 1);
+	}
+	else
+	{
+		k = ft_match_tail(pat, val, longest);
+		if (k >= 0)
+			val[k] = '\0';
+	}
+	free(pat);
+	return (val);
+}
+
+/**
+ * @brief Expands `${name/pat/rep}` and `${name//pat/rep}`.
+ *
+ * The first (or, with `//`, every) longest match of the pattern is replaced
+ * by the expanded replacement. A missing replacement deletes the matches.
+ *
+ * @param val The current value of the parameter. It is freed.
+ * @param spec Pointer to the text after the first `/`.
+ * @param sh A pointer to the shell structure.
+ * @return The newly allocated result.
+ */
+char	*ft_param_replace(char *val, char *spec, t_shell *sh)
+{
+	char	*pat;
+	char	*rep;
+	char	*slash;
+	char	*res;
+	bool	global;
+
+	global = (spec[0] == '/');
+	spec += global;
+	slash = ft_strchr(spec, '/');
+	if (slash)
+		*slash = '\0';
+	pat = ft_expand_word(spec, sh, true);
+	if (slash)
+		rep = ft_expand_word(slash + 1, sh, true);
+	else
+		rep = ft_strdup("");
+	if (slash)
+		*slash = '/';
+	if (!pat || !rep || !*pat)
+		return (free(pat), free(rep), val);
+	res = ft_replace_pattern(val, pat, rep, global);
+	return (free(pat), free(rep), free(val), res);
+}
@@ -0,0 +1,124 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_expand_braces_utils_bonus.c                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: joneves- <joneves-@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by joneves-          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by joneves-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell_bonus.h"
+
+/**
+ * @brief Expands the word part of a braced parameter expansion.
+ *
+ * The word is expanded like a token (variables, nested `${...}`, quoting).
+ * Patterns are matched against the unquoted text, so quotes can optionally be
+ * removed from the result. The word is a single field: a `"${name[@]}"` in
+ * it is joined with spaces.
+ *
+ * @param word The word to be expanded. It is not modified.
+ * @param sh A pointer to the shell structure.
+ * @param unquote Whether quotes should be removed from the result.
+ * @return A newly allocated expanded word, never NULL on success.
+ */
+char	*ft_expand_word(char *word, t_shell *sh, bool unquote)
+{
+	t_token	tkn;
+	bool	split;
+
+	split = sh->split;
+	sh->split = false;
+	tkn.value = ft_expand_str(word, sh);
+	sh->split = split;
+	if (!tkn.value)
+		tkn.value = ft_strdup("");
+	if (tkn.value && unquote)
+		ft_remove_quotes(&tkn);
+	return (tkn.value);
+}
+
+/**
+ * @brief Assigns a value to a shell variable, as `${name:=word}` requires.
+ *
+ * The assignment follows the same rules as a `name=value` command: an
+ * exported variable is updated in place, a variable waiting in the limbo is
+ * exported, and anything else becomes a local variable. Unlike the `export`
+ * path, the exit status is left untouched.
+ *
+ * @param name The null-terminated variable name.
+ * @param word The value to be assigned.
+ * @param sh A pointer to the shell structure.
+ */
+void	ft_assign_param(char *name, char *word, t_shell *sh)
+{
+	char	*str;
+
+	str = merge(ft_strjoin(name, "="), word);
+	if (!str)
+		return (ft_error_malloc("ft_assign_param"));
+	if (replace_var(str, &(sh->global), LOCAL, sh) == -1
+		&& ft_limbo_import(sh, str) == -1)
+		replace_var(str, &(sh->local), DEFAULT, sh);
+	free(str);
+}
+
+/**
+ * @brief Applies the default-value and assignment operators.
+ *
+ * Handles `${name:-word}` and `${name:=word}`: when the parameter is unset or
+ * empty, `word` is expanded and used instead. With `:=` the expanded word is
+ * also assigned to the parameter.
+ *
+ * @param val The current value of the parameter. It is either returned or
+ *        freed.
+ * @param name The null-terminated parameter name.
+ * @param op Pointer to the operator (`:-` or `:=`) followed by the word.
+ * @param sh A pointer to the shell structure.
+ * @return The resulting value.
+ */
+static char	*ft_param_default(char *val, char *name, char *op, t_shell *sh)
+{
+	char	*word;
+
+	if (*val)
+		return (val);
+	free(val);
+	word = ft_expand_word(op + 2, sh, false);
+	if (op[1] == '=' && name[0] != '?')
+		ft_assign_param(name, word, sh);
+	return (word);
+}
+
+/**
+ * @brief Dispatches a braced expansion to the handler of its operator.
+ *
+ * @param val The current value of the parameter, or NULL if it is unset.
+ *        Ownership is transferred to this function.
+ * @param name The null-terminated parameter name.
+ * @param op Pointer to the text following the name.
+ * @param sh A pointer to the shell structure.
+ * @return The expanded value, or NULL if the operator is not supported.
+ */
+char	*ft_param_operator(char *val, char *name, char *op, t_shell *sh)
+{
+	if (!val)
+		val = ft_strdup("");
+	if (!val)
+		return (ft_error_malloc("val"), NULL);
+	if (!*op)
+		return (val);
+	if (op[0] == ':' && (op[1] == '-' || op[1] == '='))
+		return (ft_param_default(val, name, op, sh));
+	if (op[0] == ':')
+		return (ft_param_substr(val, op + 1, sh));
+	if (op[0] == '#' || op[0] == '%')
+		return (ft_param_trim(val, op, sh));
+	if (op[0] == '/')
+		return (ft_param_replace(val, op + 1, sh));
+	free(val);
+	return (NULL);
+}
@@ -0,0 +1,148 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_expand_fields_bonus.c                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: joneves- <joneves-@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by joneves-          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by joneves-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell_bonus.h"
+
+/**
+ * @brief Records the elements of a `${name[@]}` expansion, one per field.
+ *
+ * Only done while a token is being expanded (see `ft_expand_tokens`). A
+ * trimming or replacing operator applies to every element on its own, and
+ * `:-` or `:=` keeps the elements as long as their joined value is not
+ * empty. With any other operator, only the joined value is used.
+ *
+ * @param body The parameter, starting with its name.
+ * @param len The length of the name.
+ * @param value The joined value of the elements, or NULL.
+ * @param sh A pointer to the shell structure, whose `elems` receives the
+ *        newly allocated, NULL-terminated vector of elements.
+ */
+void	ft_array_fields(char *body, int len, char *value, t_shell *sh)
+{
+	t_array	*arr;
+	char	**values;
+	char	*op;
+	bool	pattern;
+	int		i;
+
+	op = ft_strchr(body + len, ']') + 1;
+	pattern = (*op == '#' || *op == '%' || *op == '/');
+	arr = ft_array_find(body, len, sh);
+	if (!sh->split || !arr || (*op && !pattern && (op[0] != ':'
+				|| (op[1] != '-' && op[1] != '=') || !value || !*value)))
+		return ;
+	values = ft_array_values(arr);
+	i = -1;
+	while (values && values[++i])
+	{
+		values[i] = ft_strdup(values[i]);
+		if (pattern)
+			values[i] = ft_param_operator(values[i], "", op, sh);
+	}
+	sh->elems = values;
+}
+
+/**
+ * @brief Ends the current field of a double-quoted word and starts the next.
+ *
+ * The field is closed with a double quote and queued in the shell's
+ * `fields` list; the next one opens with a double quote.
+ *
+ * @param new_value A pointer to the field being built.
+ * @param sh A pointer to the shell structure.
+ */
+static void	ft_push_field(char **new_value, t_shell *sh)
+{
+	t_list	*node;
+
+	*new_value = ft_charjoin(*new_value, DQUOTE);
+	node = ft_lstnew(*new_value);
+	if (!node)
+		return (ft_error_malloc("node"));
+	ft_lstadd_back(&sh->fields, node);
+	*new_value = ft_charjoin(NULL, DQUOTE);
+}
+
+/**
+ * @brief Handles an expansion inside double quotes, honouring `"${name[@]}"`.
+ *
+ * The expansion is appended as usual; if it recorded the elements of an
+ * array, the joined value is dropped again and every element ends up in a
+ * field of its own instead: the text before the expansion sticks to the
+ * first element and the text after it to the last one.
+ *
+ * @param new_value A pointer to the string being built.
+ * @param value Original input string.
+ * @param i Pointer to the index, updated past the expansion.
+ * @param sh A pointer to the shell structure.
+ */
+void	ft_expand_fields(char **new_value, char *value, int *i, t_shell *sh)
+{
+	size_t	len;
+	int		k;
+
+	ft_free_vector(sh->elems);
+	sh->elems = NULL;
+	len = ft_strlen(*new_value);
+	ft_handle_expansion(new_value, value, i, sh);
+	if (!sh->elems || !*new_value)
+		return ;
+	(*new_value)[len] = '\0';
+	k = -1;
+	while (sh->elems[++k])
+	{
+		if (k > 0)
+			ft_push_field(new_value, sh);
+		*new_value = merge(*new_value, sh->elems[k]);
+	}
+	ft_free_vector(sh->elems);
+	sh->elems = NULL;
+}
+
+/**
+ * @brief Turns the fields queued by an expansion into tokens of their own.
+ *
+ * The token keeps the first field, and the others, the last one being its
+ * expanded value, are spliced after it as copies of the token. The copies are
+ * already expanded, so only their quotes are removed later on.
+ *
+ * @param node The node of the token that was just expanded.
+ * @param sh A pointer to the shell structure holding the queued fields.
+ */
+void	ft_insert_fields(t_list *node, t_shell *sh)
+{
+	t_token	*tkn;
+	t_token	*copy;
+	t_list	*field;
+	t_list	*next;
+
+	tkn = (t_token *)node->content;
+	ft_lstadd_back(&sh->fields, ft_lstnew(tkn->value));
+	tkn->value = sh->fields->content;
+	field = sh->fields->next;
+	free(sh->fields);
+	sh->fields = NULL;
+	next = node->next;
+	ft_lstlast(field)->next = next;
+	node->next = field;
+	while (field != next)
+	{
+		copy = (t_token *)malloc(sizeof(t_token));
+		if (!copy)
+			return (ft_error_malloc("copy"));
+		*copy = *tkn;
+		copy->value = field->content;
+		copy->expand = false;
+		field->content = copy;
+		field = field->next;
+	}
+}
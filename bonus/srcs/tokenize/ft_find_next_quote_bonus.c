@@ -21,7 +21,9 @@
  * encounters an unsupported `$` expansion within double quotes (like `$`
  * followed by certain characters defined in `NON_EXPANDABLE`), it prints an
  * error message and returns `-1`. If no matching quote is found, it also
- * prints an error message about open quotes and returns `-1`.
+ * prints an error message about open quotes and returns `-1`. Inside double
+ * quotes, `${...}` and `$(...)` expansions are skipped as a whole, so quotes
+ * nested in them do not end the quoted section.
  *
  * @param s The string to search through.
  * @param i The starting index after which to search for the quote.
@@ -35,7 +37,51 @@ int	ft_find_next_quote(char *s, int i, char quote)
 	{
 		if (s[i] == quote)
 			return (i);
+		if (quote == DQUOTE && s[i] == '$' && (s[i + 1] == '('
+				|| s[i + 1] == '{') && ft_find_next_brace(s, i) != -1)
+			i = ft_find_next_brace(s, i);
 		i++;
 	}
 	return (-1);
 }
+
+/**
+ * @brief Finds the brace that closes a `${` or `$(` expansion.
+ *
+ * Starting at the `$` of a `${` or `$(` sequence, this function scans forward
+ * for the matching `}` or `)`. Nested `${` expansions (or nested parentheses)
+ * are taken into account and quoted sections are skipped, so braces inside
+ * quotes are not counted.
+ *
+ * @param s The string to search.
+ * @param i The index of the `$` that opens the expansion.
+ * @return The index of the matching closing brace, or -1 if it is not found.
+ */
+int	ft_find_next_brace(char *s, int i)
+{
+	char	open;
+	char	close;
+	int		depth;
+
+	open = s[i + 1];
+	close = '}';
+	if (open == '(')
+		close = ')';
+	depth = 0;
+	while (s[++i])
+	{
+		if (s[i] == SQUOTE || s[i] == DQUOTE)
+			i = ft_find_next_quote(s, i, s[i]);
+		if (i == -1)
+			return (-1);
+		else if (s[i] == open && (open == '(' || s[i - 1] == '$'))
+			depth++;
+		else if (s[i] == close)
+		{
+			depth--;
+			if (depth == 0)
+				return (i);
+		}
+	}
+	return (-1);
+}
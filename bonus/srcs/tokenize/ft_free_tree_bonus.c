@@ -17,7 +17,8 @@
  *
  * This function frees the memory allocated for the arguments of an EXEC node. 
  * It checks if the `args` list is non-NULL and, if so, it deallocates the list
- * of arguments associated with the EXEC node. The EXEC node itself is not
+ * of arguments associated with the EXEC node, and does the same for the list
+ * of prefix assignments. The EXEC node itself is not
  * freed here, as it's handled elsewhere.
  *
  * @param exec_node A pointer to the EXEC node whose arguments should be freed.
@@ -29,6 +30,11 @@ static void	ft_free_exec(t_exec *exec_node)
 		ft_free_list(*exec_node->args);
 		free(exec_node->args);
 	}
+	if (exec_node->assigns)
+	{
+		ft_free_list(*exec_node->assigns);
+		free(exec_node->assigns);
+	}
 }
 
 /**
@@ -82,7 +88,7 @@ static void	ft_free_node(void *root)
 		return ;
 	node = (t_node *)root;
 	if (node->type == ROOT || node->type == AND || node->type == OR
-		|| node->type == PIPE || node->type == SUB_ROOT)
+		|| node->type == PIPE || node->type == SUB_ROOT || node->type == BG)
 	{
 		if (node->left)
 			ft_free_node(node->left);
@@ -48,7 +48,8 @@ bool	ft_is_token_type(t_token *token, t_type type)
 	}
 	if (type == NODE)
 	{
-		if (token->type == PIPE || token->type == AND || token->type == OR)
+		if (token->type == PIPE || token->type == AND || token->type == OR
+			|| token->type == BG)
 			return (true);
 	}
 	return (false);
@@ -92,7 +93,8 @@ bool	ft_is_node_type(t_node *node, t_type type)
 	}
 	if (type == NODE)
 	{
-		if (node->type == PIPE || node->type == AND || node->type == OR)
+		if (node->type == PIPE || node->type == AND || node->type == OR
+			|| node->type == BG)
 			return (true);
 	}
 	if (type == REDIR_OUT)
@@ -18,7 +18,8 @@
  * This function takes input string, trims leading and trailing whitespace,
  * validates its syntax, and tokenizes it into a list. It then constructs a
  * syntax tree representing the input commands and redirections. If any step
- * fails, the function cleans up allocated memory and returns NULL.
+ * fails, or the input is blank, the function cleans up allocated memory and
+ * returns NULL.
  * 
  * @param input The raw input string to process.
  * @return A pointer to the root of the syntax tree if successful, or NULL on
@@ -34,6 +35,8 @@ void	*ft_process_input(char *input)
 	trimmed = ft_strtrim(input, ISSPACE);
 	if (!trimmed)
 		return (ft_error_malloc("ft_strtrim"), NULL);
+	if (!*trimmed)
+		return (free(trimmed), NULL);
 	if (!ft_validate_syntax(trimmed))
 		return (free(trimmed), NULL);
 	token_list = ft_create_token_list(trimmed);
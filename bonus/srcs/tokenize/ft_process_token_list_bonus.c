@@ -124,15 +124,27 @@ void	ft_remove_current_node(t_list **list, t_list *prev, t_list *curr)
  *    enabled.
  * 2. Removes surrounding or embedded quotes (`'` or `"`) if the token is in a
  *    quoted state.
+ * The word list of an array assignment keeps its quotes, as its words are
+ * expanded and unquoted one by one when the assignment is performed. The
+ * value of a `NAME=value` assignment is never globbed. The fields of a
+ * `"${name[@]}"` expansion are inserted as new tokens after this one.
  *
- * @param token A pointer to the token structure to be processed.
- * @param envp A null-terminated array of strings representing the environment
- *        variables.
+ * @param node The node of the token to be processed.
+ * @param sh A pointer to the shell structure holding the variable stores.
  */
-static void	ft_process_expansion_and_quotes(t_token *token, char **envp)
+static void	ft_process_expansion_and_quotes(t_list *node, t_shell *sh)
 {
+	t_token	*token;
+
+	token = (t_token *)node->content;
+	if (ft_array_form(token->value) == ARRAY_LIST)
+		return ;
+	if (token->type == EXPORT || token->type == EXPORT_AP)
+		token->wildcard = false;
 	if (token->expand)
-		ft_expand_tokens(token, envp);
+		ft_expand_tokens(token, sh);
+	if (sh->fields)
+		ft_insert_fields(node, sh);
 	if (token->state == IN_QUOTE)
 		ft_remove_quotes(token);
 }
@@ -144,14 +156,15 @@ static void	ft_process_expansion_and_quotes(t_token *token, char **envp)
  * This function iterates through a list of tokens, applying token-specific
  * transformations such as environment variable expansion, quote removal, and
  * wildcard processing. Empty tokens generated after expansion that are in
- * `IN_QUOTE` state are removed from the list.
+ * `IN_QUOTE` state are removed from the list. Tokens flagged for brace
+ * expansion keep a single node: their braces are expanded before their
+ * wildcards, word by word, straight into the argv built by `tokentostring`.
  *
  * @param list A pointer to the head of the linked list of tokens to be
  *        processed.
- * @param envp A null-terminated array of strings representing the environment
- *        variables.
+ * @param sh A pointer to the shell structure holding the variable stores.
  */
-void	ft_process_token_list(t_list **list, char **envp)
+void	ft_process_token_list(t_list **list, t_shell *sh)
 {
 	t_list	*current;
 	t_list	*prev;
@@ -164,18 +177,18 @@ void	ft_process_token_list(t_list **list, char **envp)
 	{
 		next = current->next;
 		token = (t_token *)current->content;
-		ft_process_expansion_and_quotes(token, envp);
+		ft_process_expansion_and_quotes(current, sh);
 		if (!*token->value && token->expand && !token->state)
 		{
 			ft_remove_current_node(list, prev, current);
 			current = next;
 			continue ;
 		}
-		if (token->wildcard && ft_handle_wildcard(&current, prev, list))
+		if (token->wildcard && !token->brace
+			&& ft_handle_wildcard(&current, prev, list))
 			prev = NULL;
 		else
 			prev = current;
 		current = current->next;
 	}
-	ft_free_vector(envp);
 }
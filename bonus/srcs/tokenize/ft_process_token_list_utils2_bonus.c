@@ -17,8 +17,10 @@
  *        variable.
  * 
  * Checks if the string `s` begins with a valid environment variable name
- * (alphabetic character or underscore followed by an alphanumeric character)
- * or with `$?`, indicating the exit status. If so, the function returns `true`
+ * (alphabetic character or underscore followed by an alphanumeric character),
+ * with `$?`, indicating the exit status, with `$$` or `$!`, the PIDs of the
+ * shell and of the last background process, or with `${`, opening a braced
+ * parameter expansion. If so, the function returns `true`
  * indicating that the string can be expanded; otherwise, it returns `false`.
  * 
  * @param s Pointer to the string to check for expandability.
@@ -29,7 +31,8 @@ bool	ft_is_expandable(char *s)
 	int	i;
 
 	i = 0;
-	if (ft_isalpha(s[i]) || s[i] == '?' || s[i] == '*'
+	if (ft_isalpha(s[i]) || s[i] == '?' || s[i] == '*' || s[i] == '{'
+		|| s[i] == '(' || s[i] == '$' || s[i] == '!'
 		|| (s[i] == '_' && s[i + 1] && ft_isalnum(s[i + 1])))
 		return (true);
 	return (false);
@@ -73,37 +76,61 @@ void	ft_remove_quotes(t_token *tkn)
 }
 
 /**
- * @brief Expands environment variables in a token's value.
+ * @brief Expands the variables of a string, honouring its quoting.
  * 
- * This function iterates through each character in a token's value. If it
+ * This function iterates through each character in `value`. If it
  * encounters single quotes, expansion doesn't occur. If it finds a `$`
  * followed by an expandable identifier, that is either between double quotes
- * or none, it replaces it with the corresponding environment variable value
- * The resulting expanded string is assigned to the token's value.
+ * or none, it replaces it with the corresponding environment variable value.
+ * Quotes are kept in the result so they can be removed later.
  * 
- * @param token Pointer to the token to be expanded.
- * @param envp Environment variable array used for expansion.
+ * @param value The string to be expanded. It is not modified nor freed.
+ * @param sh A pointer to the shell structure used for expansion.
+ * @return A newly allocated expanded string, or NULL if `value` is empty.
  */
-void	ft_expand_tokens(t_token *token, char **envp)
+char	*ft_expand_str(char *value, t_shell *sh)
 {
 	char	*new_value;
 	int		i;
 
 	new_value = NULL;
 	i = 0;
-	while (token->value[i])
+	while (value[i])
 	{
-		if (token->value[i] == SQUOTE)
-			ft_handle_squotes(&new_value, token->value, &i);
-		else if (token->value[i] == DQUOTE)
-			ft_handle_dquotes(&new_value, token->value, &i, envp);
-		else if (token->value[i] == '$'
-			&& ft_is_expandable(&token->value[i + 1]))
-			ft_handle_expansion(&new_value, token->value, &i, envp);
-		else if (token->value[i] && token->value[i] != DQUOTE
-			&& token->value[i] != SQUOTE)
-			new_value = ft_charjoin(new_value, token->value[i++]);
+		if (value[i] == SQUOTE)
+			ft_handle_squotes(&new_value, value, &i);
+		else if (value[i] == DQUOTE)
+			ft_handle_dquotes(&new_value, value, &i, sh);
+		else if ((value[i] == '$' && ft_is_expandable(&value[i + 1]))
+			|| ((value[i] == '<' || value[i] == '>') && value[i + 1] == '('))
+			ft_handle_expansion(&new_value, value, &i, sh);
+		else if (value[i] && value[i] != DQUOTE && value[i] != SQUOTE)
+			new_value = ft_charjoin(new_value, value[i++]);
 	}
+	return (new_value);
+}
+
+/**
+ * @brief Expands environment variables in a token's value.
+ * 
+ * The token's value is expanded by `ft_expand_str` and the resulting string
+ * replaces the original one. Except in an assignment, a quoted
+ * `"${name[@]}"` expansion queues all but its last field in the shell's
+ * `fields` list, for `ft_insert_fields` to turn into tokens.
+ * 
+ * @param token Pointer to the token to be expanded.
+ * @param sh A pointer to the shell structure used for expansion.
+ */
+void	ft_expand_tokens(t_token *token, t_shell *sh)
+{
+	char	*new_value;
+
+	sh->fields = NULL;
+	sh->split = (token->type != EXPORT && token->type != EXPORT_AP);
+	new_value = ft_expand_str(token->value, sh);
+	sh->split = false;
+	ft_free_vector(sh->elems);
+	sh->elems = NULL;
 	free(token->value);
 	token->value = new_value;
 }
@@ -16,42 +16,35 @@
  * @brief Expands an environment variable found in a string.
  * 
  * This function extracts an environment variable name from the input string
- * and searches for its value in the environment variable array. If found, it
- * returns the corresponding value; otherwise, it returns an empty string. It
- * updates the index to skip past the environment variable name.
+ * and searches for its value in the shell's variable stores. If found, it
+ * returns a copy of the corresponding value; otherwise, it returns an empty
+ * string. It updates the index to skip past the environment variable name.
+ * The one-character names `$` and `!` are looked up like any other name, and
+ * special variables are computed on demand by the lookup itself.
  * 
  * @param s Pointer to the current position in the input string.
  * @param i Pointer to the index, which is updated to skip past the variable
  *        name.
- * @param envp Array of environment variables.
+ * @param sh A pointer to the shell structure holding the variable stores.
  * @return The expanded environment variable value or an empty string.
  */
-static char	*ft_expand_env(char *s, int *i, char **envp)
+static char	*ft_expand_env(char *s, int *i, t_shell *sh)
 {
-	char	*expansion;
-	char	*env;
-	char	*env_equal;
+	char	*value;
 	int		len;
-	int		j;
 
-	len = 0;
-	while (ft_isalpha(s[len]) || ft_isdigit(s[len]) || s[len] == '_')
-		len++;
-	env = ft_substr(s, 0, len);
-	env_equal = ft_strjoin(env, "=");
-	j = 0;
-	while (envp[j])
+	len = 1;
+	if (s[0] != '$' && s[0] != '!')
 	{
-		if (ft_strncmp(env_equal, envp[j], (len + 1)) == 0)
-		{
-			expansion = ft_strdup(envp[j] + (len + 1));
-			(*i) += len;
-			return (free(env_equal), free(env), expansion);
-		}
-		j++;
+		len = 0;
+		while (ft_isalpha(s[len]) || ft_isdigit(s[len]) || s[len] == '_')
+			len++;
 	}
 	(*i) += len;
-	return (free(env_equal), free(env), ft_strdup("\0"));
+	value = ft_getvar(s, len, sh);
+	if (!value)
+		return (ft_strdup("\0"));
+	return (ft_strdup(value));
 }
 
 /**
@@ -84,36 +77,45 @@ static char	*ft_get_exit_code(int *i)
  * on the character following a `$` symbol and appends the expanded value to
  * the `new_value` string. For the positional parameter (`*`) expansion,
  * preceeded by `$`,it expands to NULL, as wildcard handling is done elsewhere.
- * 
+ * A `{` following the `$` starts a braced parameter expansion, which is
+ * delegated to `ft_expand_braces`, `((` starts an arithmetic expansion,
+ * evaluated in-process by `ft_expand_arith`, and `(` starts a command
+ * substitution, run by `ft_expand_cmdsub`. A `<(` or `>(` (instead of `$`)
+ * starts a process substitution, handled by `ft_expand_procsub`.
+ *
  * @param new_value A pointer to the current expanded string being constructed. 
  *        This will be updated with the appended expanded value.
  * @param value The original string containing the variable or wildcard to
  *        expand.
  * @param i A pointer to the current position index within `value`. This index
  *        will be updated to point past the processed expansion.
- * @param envp The environment variables array used for expanding variable
+ * @param sh A pointer to the shell structure used for expanding variable
  *        names.
  */
-void	ft_handle_expansion(char **new_value, char *value, int *i, char **envp)
+void	ft_handle_expansion(char **new_value, char *value, int *i, t_shell *sh)
 {
 	char	*expansion;
-	char	*tmp;
 
-	tmp = NULL;
 	(*i)++;
-	if (value[*i] == '?')
+	if (value[*i - 1] != '$')
+		expansion = ft_expand_procsub(value, i, sh);
+	else if (value[*i] == '?')
 		expansion = ft_get_exit_code(i);
+	else if (value[*i] == '{')
+		expansion = ft_expand_braces(value, i, sh);
+	else if (value[*i] == '(' && value[*i + 1] == '(')
+		expansion = ft_expand_arith(value, i, sh);
+	else if (value[*i] == '(')
+		expansion = ft_expand_cmdsub(value, i, sh);
 	else if (value[*i] == '*')
 	{
 		(*i)++;
 		expansion = ft_strdup("\0");
 	}
 	else
-		expansion = ft_expand_env(&value[*i], i, envp);
-	tmp = ft_strjoin(*new_value, expansion);
-	free(*new_value);
+		expansion = ft_expand_env(&value[*i], i, sh);
+	*new_value = merge(*new_value, expansion);
 	free(expansion);
-	*new_value = tmp;
 }
 
 /**
@@ -139,20 +141,21 @@ void	ft_handle_squotes(char **new_value, char *value, int *i)
  * 
  * This function appends characters within double quotes to `new_value`,
  * performing environment variable expansion for `$` symbols where applicable.
- * It updates the index to skip past the quoted section.
+ * It updates the index to skip past the quoted section. A `"${name[@]}"`
+ * expansion is split into one field per element by `ft_expand_fields`.
  * 
  * @param new_value Pointer to the string being built with expansions.
  * @param value Original input string.
  * @param i Pointer to the index, updated to skip past the quoted section.
- * @param envp Array of environment variables.
+ * @param sh A pointer to the shell structure holding the variable stores.
  */
-void	ft_handle_dquotes(char **new_value, char *value, int *i, char **envp)
+void	ft_handle_dquotes(char **new_value, char *value, int *i, t_shell *sh)
 {
 	*new_value = ft_charjoin(*new_value, value[(*i)++]);
 	while (value[*i] && value[*i] != DQUOTE)
 	{
 		if (value[*i] == '$' && ft_is_expandable(&value[*i + 1]))
-			ft_handle_expansion(new_value, value, i, envp);
+			ft_expand_fields(new_value, value, i, sh);
 		else
 			*new_value = ft_charjoin(*new_value, value[(*i)++]);
 	}
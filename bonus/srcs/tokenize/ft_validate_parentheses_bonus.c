@@ -87,7 +87,7 @@ static bool	ft_validate_left_context(char *s, int i, bool *left)
  * @brief Handles the validation of characters encountered outside parentheses.
  * 
  * This function processes characters that are not parentheses, ensuring:
- * - Quoted strings are handled by skipping to the closing quote.
+ * - Quoted strings and `${...}` expansions are skipped as a whole.
  * - Right parentheses ')' are followed by valid operators like '|', '&', '>',
  *   or '<'.
  * - No unexpected tokens appear after a right parenthesis.
@@ -106,8 +106,11 @@ static bool	ft_validate_left_context(char *s, int i, bool *left)
  */
 static bool	ft_handle_chars(char *s, int *i, bool *right, bool *left)
 {
-	if (s[*i] == DQUOTE || s[*i] == SQUOTE)
-		*i = ft_find_next_quote(s, *i, s[*i]);
+	int	end;
+
+	end = ft_skip_group(s, *i);
+	if (end != *i)
+		*i = end;
 	else if (*right && s[*i] != '|' && s[*i] != '&'
 		&& s[*i] != '>' && s[*i] != '<')
 	{
@@ -125,8 +128,8 @@ static bool	ft_handle_chars(char *s, int *i, bool *right, bool *left)
  * 
  * This function ensures that every opening parenthesis '(' is properly closed
  * by a corresponding closing parenthesis ')'. It also skips over characters
- * enclosed in single or double quotes to avoid misinterpreting symbols within
- * quoted strings.
+ * enclosed in single or double quotes, or in a `${...}` expansion, to avoid
+ * misinterpreting symbols within them.
  * 
  * @param s The input string to validate.
  * @return `true` if all parentheses are balanced; `false` otherwise.
@@ -137,13 +140,19 @@ static bool	ft_handle_chars(char *s, int *i, bool *right, bool *left)
 bool	ft_count_parentheses(char *s)
 {
 	int	i;
+	int	end;
 	int	count;
 
 	count = 0;
 	i = -1;
 	while (s[++i])
 	{
-		if (s[i] == '(')
+		end = ft_skip_group(s, i);
+		if (end == -1)
+			return (false);
+		else if (end != i)
+			i = end;
+		else if (s[i] == '(')
 			count++;
 		else if (s[i] == ')')
 		{
@@ -151,12 +160,6 @@ bool	ft_count_parentheses(char *s)
 				return (ft_error_syntax(UNEXPECTED_TOKEN, s[i]), false);
 			count--;
 		}
-		else if (s[i] == DQUOTE || s[i] == SQUOTE)
-		{
-			i = ft_find_next_quote(s, i, s[i]);
-			if (i == -1)
-				return (ft_error_syntax(OPEN_QUOTE, 0), false);
-		}
 	}
 	if (count == 0)
 		return (true);
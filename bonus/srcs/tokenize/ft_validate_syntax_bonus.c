@@ -54,7 +54,8 @@ void	ft_error_syntax(char *message, char c)
  */
 static int	ft_handle_specialchars(char *s, int i, bool *special, char *c)
 {
-	if (s[i] == '&' && s[i + 1] != '&')
+	if (s[i] == '&' && s[i + 1] != '&' && ((*special && *c == '&')
+			|| s[i + 1] == '<' || s[i + 1] == '>'))
 		return (ft_error_syntax(UNEXPECTED_TOKEN, s[i]), -1);
 	if (*special == true)
 	{
@@ -91,13 +92,13 @@ static int	ft_handle_specialchars(char *s, int i, bool *special, char *c)
  * @param i The current index in the string.
  * @param special Pointer to a boolean flag indicating if the current character
  *        is special.
+ * @param special_char Pointer to the last special character seen, owned by
+ *        the caller so that validation keeps no state between lines.
  * @return The updated index after processing the current character, or `-1` if
  *         an error occurs.
  */
-static int	ft_iterate_str(char *s, int i, bool *special)
+static int	ft_iterate_str(char *s, int i, bool *special, char *special_char)
 {
-	static char	special_char;
-
 	if (s[i] == SQUOTE || s[i] == DQUOTE)
 	{
 		i = ft_find_next_quote(s, i, s[i]);
@@ -105,13 +106,15 @@ static int	ft_iterate_str(char *s, int i, bool *special)
 			return (ft_error_syntax(OPEN_QUOTE, 0), -1);
 		*special = false;
 	}
+	else if (ft_skip_group(s, i) != i)
+		return (ft_skip_group(s, i));
 	if (ft_strchr(INVALIDCHARS, s[i]))
 		return (ft_error_syntax(UNEXPECTED_TOKEN, s[i]), -1);
 	if (ft_strchr(METACHARS, s[i]) || ft_strchr(SPECIALCHARS, s[i])
 		|| (s[i] == '.' && (ft_isspace(s[i + 1])
 				|| s[i + 1] == '\0')))
 	{
-		i = ft_handle_specialchars(s, i, special, &special_char);
+		i = ft_handle_specialchars(s, i, special, special_char);
 		if (i == -1)
 			return (-1);
 	}
@@ -125,15 +128,16 @@ static int	ft_iterate_str(char *s, int i, bool *special)
  * according to predefined rules. It identifies special cases like comments
  * (`#`), invalid characters, and unsupported tokens. If the first character
  * is invalid, an error is reported, the exit status is updated, and the
- * function returns `true`. Otherwise, it updates the `special` flag and
- * returns `false`.
+ * function returns `true`. Otherwise, it resets the `special` flag and the
+ * last special character, and returns `false`.
  * 
  * @param s The input string to validate.
  * @param special Pointer to a boolean flag indicating if the first character
  *        is special.
+ * @param special_char Pointer to the last special character seen.
  * @return `true` if the first character is invalid; `false` otherwise.
  */
-static bool	ft_invalid_first_chr(char *s, bool *special)
+static bool	ft_invalid_first_chr(char *s, bool *special, char *special_char)
 {
 	if (s[0] == '#' || s[0] == ':')
 		return (true);
@@ -153,6 +157,7 @@ static bool	ft_invalid_first_chr(char *s, bool *special)
 		}
 	}
 	*special = false;
+	*special_char = '\0';
 	return (false);
 }
 
@@ -174,14 +179,15 @@ bool	ft_validate_syntax(char *trim)
 {
 	int		i;
 	bool	special;
+	char	special_char;
 
-	if (ft_invalid_first_chr(trim, &special) || !ft_count_parentheses(trim)
-		|| !ft_validate_parentheses(trim))
+	if (ft_invalid_first_chr(trim, &special, &special_char)
+		|| !ft_count_parentheses(trim) || !ft_validate_parentheses(trim))
 		return (false);
 	i = 0;
 	while (trim[i])
 	{
-		i = ft_iterate_str(trim, i, &special);
+		i = ft_iterate_str(trim, i, &special, &special_char);
 		if (i == -1)
 			return (false);
 		if (trim[i] && !ft_isspace(trim[i]) && !ft_strchr(METACHARS, trim[i]))
@@ -193,7 +199,7 @@ bool	ft_validate_syntax(char *trim)
 		if (trim[i])
 			i++;
 	}
-	if (special == true)
+	if (special == true && !ft_is_background(trim, i))
 		return (ft_error_syntax(UNEXPECTED_TOKEN, trim[i - 1]), false);
 	return (true);
 }
@@ -57,3 +57,60 @@ bool	ft_is_comment(char c, int *i)
 	}
 	return (false);
 }
+
+/**
+ * @brief Skips a quoted section, a `${...}`, `$(...)`, `<(...)`, `>(...)` or
+ *        the `=(...)` of an array assignment.
+ *
+ * If `s[i]` opens a group that must be kept as a single unit (single or double
+ * quotes, a braced parameter expansion, a command or process substitution or
+ * an arithmetic expansion, whose nested parentheses are not subshells, or
+ * the word list of an array assignment), this
+ * function returns the index
+ * of the character that closes it. Characters inside a group are never
+ * interpreted as operators by the validators or the tokenizer.
+ *
+ * @param s The input string.
+ * @param i The current index in the string.
+ * @return The index of the closing character, `i` itself if `s[i]` does not
+ *         open a group, or `-1` (with a syntax error reported) if the group
+ *         is never closed.
+ */
+int	ft_skip_group(char *s, int i)
+{
+	int	end;
+
+	if (s[i] == SQUOTE || s[i] == DQUOTE)
+		end = ft_find_next_quote(s, i, s[i]);
+	else if ((s[i] == '$' && s[i + 1] == '{') || (s[i + 1] == '('
+			&& (s[i] == '$' || s[i] == '<' || s[i] == '>' || s[i] == '=')))
+		end = ft_find_next_brace(s, i);
+	else
+		return (i);
+	if (end == -1 && (s[i] == SQUOTE || s[i] == DQUOTE))
+		ft_error_syntax(OPEN_QUOTE, 0);
+	else if (end == -1 && s[i + 1] == '(')
+		ft_error_syntax(OPEN_PRTHESES, 0);
+	else if (end == -1)
+		ft_error_syntax(OPEN_BRACE, 0);
+	return (end);
+}
+
+/**
+ * @brief Checks if a line ends with a single background operator.
+ * 
+ * A trailing `&` leaves the validator in the special state like any other
+ * dangling operator, but unlike `|` or `&&` it completes the list before it.
+ * This function tells the two apart so that `cmd &` is accepted while
+ * `cmd &&` is still reported.
+ * 
+ * @param s The input string being validated.
+ * @param i The length of the validated part of the string.
+ * @return `true` if the string ends with a lone `&`, otherwise `false`.
+ */
+bool	ft_is_background(char *s, int i)
+{
+	if (i < 2 || s[i - 1] != '&')
+		return (false);
+	return (s[i - 2] != '&');
+}
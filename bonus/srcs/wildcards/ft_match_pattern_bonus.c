@@ -0,0 +1,181 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_match_pattern_bonus.c                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: joneves- <joneves-@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by joneves-          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by joneves-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell_bonus.h"
+
+/**
+ * @brief Matches a string against a shell pattern, with backtracking state.
+ *
+ * The match is done in a single pass, backtracking only to the position
+ * after the last `*` seen, so it never recurses and runs in
+ * O(len(pattern) * len(str)) in the worst case.
+ *
+ * @param pat The pattern to match.
+ * @param str The string to be tested.
+ * @param star The pattern position right after the last `*` seen, or NULL.
+ * @param back The string position where the last `*` started matching.
+ * @return `true` if the whole `str` matches `pat`; `false` otherwise.
+ */
+static bool	ft_match_glob(char *pat, char *str, char *star, char *back)
+{
+	while (*str)
+	{
+		if (*pat == '*')
+		{
+			star = ++pat;
+			back = str;
+		}
+		else if (*pat && (*pat == '?' || *pat == *str))
+		{
+			pat++;
+			str++;
+		}
+		else if (star)
+		{
+			pat = star;
+			str = ++back;
+		}
+		else
+			return (false);
+	}
+	while (*pat == '*')
+		pat++;
+	return (*pat == '\0');
+}
+
+/**
+ * @brief Matches a string against a shell pattern.
+ *
+ * Supports `*` (any sequence, including the empty one) and `?` (any single
+ * character).
+ *
+ * @param pat The pattern to match.
+ * @param str The string to be tested.
+ * @return `true` if the whole `str` matches `pat`; `false` otherwise.
+ */
+bool	ft_match_pattern(char *pat, char *str)
+{
+	return (ft_match_glob(pat, str, NULL, NULL));
+}
+
+/**
+ * @brief Finds the length of the prefix of `str` that matches `pat`.
+ *
+ * The string is temporarily truncated at each candidate length so that the
+ * same matcher can be used without allocating substrings. Candidates are
+ * tried from the shortest to the longest, or the other way around when
+ * `longest` is set.
+ *
+ * @param pat The pattern to match.
+ * @param str The string whose prefixes are tested. It is restored before
+ *        returning.
+ * @param longest Whether the longest matching prefix should be returned.
+ * @return The length of the matching prefix, or -1 if none matches.
+ */
+int	ft_match_head(char *pat, char *str, bool longest)
+{
+	int		len;
+	int		k;
+	int		step;
+	char	c;
+	bool	matched;
+
+	len = ft_strlen(str);
+	k = 0;
+	step = 1;
+	if (longest)
+	{
+		k = len;
+		step = -1;
+	}
+	while (k >= 0 && k <= len)
+	{
+		c = str[k];
+		str[k] = '\0';
+		matched = ft_match_pattern(pat, str);
+		str[k] = c;
+		if (matched)
+			return (k);
+		k += step;
+	}
+	return (-1);
+}
+
+/**
+ * @brief Finds the start of the suffix of `str` that matches `pat`.
+ *
+ * Candidates are tried from the shortest suffix to the longest one, or the
+ * other way around when `longest` is set.
+ *
+ * @param pat The pattern to match.
+ * @param str The string whose suffixes are tested.
+ * @param longest Whether the longest matching suffix should be returned.
+ * @return The index where the matching suffix starts, or -1 if none matches.
+ */
+int	ft_match_tail(char *pat, char *str, bool longest)
+{
+	int	len;
+	int	k;
+	int	step;
+
+	len = ft_strlen(str);
+	k = len;
+	step = -1;
+	if (longest)
+	{
+		k = 0;
+		step = 1;
+	}
+	while (k >= 0 && k <= len)
+	{
+		if (ft_match_pattern(pat, &str[k]))
+			return (k);
+		k += step;
+	}
+	return (-1);
+}
+
+/**
+ * @brief Replaces the portions of `str` matching `pat` with `rep`.
+ *
+ * At each position the longest non-empty match is replaced. Only the first
+ * match is replaced unless `global` is set.
+ *
+ * @param str The string to be processed. It is not freed.
+ * @param pat The pattern to match.
+ * @param rep The replacement string.
+ * @param global Whether every match should be replaced.
+ * @return A newly allocated string with the replacements applied.
+ */
+char	*ft_replace_pattern(char *str, char *pat, char *rep, bool global)
+{
+	char	*res;
+	int		p;
+	int		m;
+
+	res = ft_strdup("");
+	p = 0;
+	while (str[p])
+	{
+		m = ft_match_head(pat, &str[p], true);
+		if (m > 0)
+		{
+			res = merge(res, rep);
+			p += m;
+			if (!global)
+				break ;
+		}
+		else
+			res = ft_charjoin(res, str[p++]);
+	}
+	return (merge(res, &str[p]));
+}
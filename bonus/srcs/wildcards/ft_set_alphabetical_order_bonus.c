@@ -43,75 +43,83 @@ static int	ft_strcmp_lower(const char *str1, const char *str2)
 }
 
 /**
- * @brief Sorts an array of strings in alphabetical order (case-insensitive).
+ * @brief Merges two sorted token lists into one (case-insensitive).
  *
- * This function sorts the given array of strings using the bubble sort 
- * algorithm and performs case-insensitive comparisons to determine order.
+ * On equal names the token from `a` comes first, so the sort is stable.
  *
- * @param str The array of strings to be sorted.
- * @param n The number of elements in the array.
+ * @param a The first sorted list.
+ * @param b The second sorted list.
+ * @return The head of the merged list.
  */
-static void	ft_sort_str_tab_(char **str, int n)
+static t_list	*ft_merge_tokens(t_list *a, t_list *b)
 {
-	int		k;
-	int		j;
-	char	*swap;
+	t_list	head;
+	t_list	*tail;
 
-	k = 0;
-	while (k < n - 1)
+	tail = &head;
+	while (a && b)
 	{
-		j = 0;
-		while (j < n - k - 1)
+		if (ft_strcmp_lower(((t_token *)a->content)->value,
+			((t_token *)b->content)->value) <= 0)
 		{
-			if (ft_strcmp_lower(str[j], str[j + 1])
-				> ft_strcmp_lower(str[j + 1], str[j]))
-			{
-				swap = str[j];
-				str[j] = str[j + 1];
-				str[j + 1] = swap;
-			}
-			j++;
+			tail->next = a;
+			a = a->next;
 		}
-		k++;
+		else
+		{
+			tail->next = b;
+			b = b->next;
+		}
+		tail = tail->next;
 	}
+	tail->next = a;
+	if (!a)
+		tail->next = b;
+	return (head.next);
 }
 
 /**
- * @brief Sorts a list of tokens alphabetically and returns the new list.
+ * @brief Sorts a token list alphabetically (case-insensitive) with a merge
+ *        sort.
  *
- * This function converts the tokens in the given list to an array of strings, 
- * sorts the strings alphabetically in a case-insensitive manner, and then 
- * recreates a token list from the sorted strings. The old token list and 
- * string array are freed before returning the new list.
+ * The list is split in halves by walking it with a slow and a fast
+ * pointer, and the sorted halves are merged, relinking the nodes in place.
  *
- * @param old A pointer to the original list of tokens to sort.
- * @return A pointer to the new list of tokens sorted alphabetically, or `NULL` 
- *         if memory allocation fails.
+ * @param list The head of the list to sort.
+ * @return The head of the sorted list.
  */
-t_list	**ft_set_alphabetical_order(t_list **old)
+static t_list	*ft_sort_tokens(t_list *list)
 {
-	t_list	**new;
-	char	**tmp;
-	int		size;
-	int		i;
+	t_list	*slow;
+	t_list	*fast;
+	t_list	*half;
 
-	new = (t_list **)malloc(sizeof(t_list *));
-	if (!new)
-		return (ft_error_malloc("new"), NULL);
-	*new = NULL;
-	tmp = tokentostring(old);
-	size = 0;
-	while (tmp[size])
-		size++;
-	ft_sort_str_tab_(tmp, size);
-	i = 0;
-	while (tmp[i])
+	if (!list || !list->next)
+		return (list);
+	slow = list;
+	fast = list->next;
+	while (fast && fast->next)
 	{
-		ft_add_to_token_list(&tmp[i], new);
-		i++;
+		slow = slow->next;
+		fast = fast->next->next;
 	}
-	ft_free_list(*old);
-	free(old);
-	ft_free_vector(tmp);
-	return (new);
+	half = slow->next;
+	slow->next = NULL;
+	return (ft_merge_tokens(ft_sort_tokens(list), ft_sort_tokens(half)));
+}
+
+/**
+ * @brief Sorts a list of tokens alphabetically and returns it.
+ *
+ * The tokens are sorted in a case-insensitive manner by relinking the list
+ * nodes, in O(n log n), without converting them to strings and back.
+ *
+ * @param list A pointer to the list of tokens to sort.
+ * @return The same pointer, whose list is now sorted alphabetically.
+ */
+t_list	**ft_set_alphabetical_order(t_list **list)
+{
+	if (list)
+		*list = ft_sort_tokens(*list);
+	return (list);
 }
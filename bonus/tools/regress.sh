@@ -0,0 +1,34 @@
+#!/bin/sh
+# Runs the regression cases in regress/ through minishell_bonus and fails if
+# any output differs from the expected one.
+#
+# A case is a pair of files: NAME.in holds the lines typed into a fresh
+# shell, started in an empty scratch directory with a fixed environment,
+# and NAME.out the output expected on stdout and stderr, prompts and colours
+# stripped. To add a case, write NAME.in and check that bash prints the
+# same thing before saving the shell's output as NAME.out.
+#
+# usage: regress.sh shell cases_dir
+
+SHELL_BIN=$1
+CASES=$2
+WORK=$(mktemp -d) || exit 1
+trap 'rm -rf "$WORK"' EXIT
+status=0
+for input in "$CASES"/*.in
+do
+	name=$(basename "$input" .in)
+	rm -rf "$WORK/dir" && mkdir "$WORK/dir" || exit 1
+	(cd "$WORK/dir" && env -i PATH=/usr/bin:/bin HOME="$WORK" TERM=dumb \
+		"$SHELL_BIN" < "$input" 2>&1) \
+		| sed 's/\x1b\[[0-9;]*m//g; s/\x01//g; s/\x02//g' \
+		| grep -v '^bashinho \$ ' > "$WORK/out"
+	if diff -u "$CASES/$name.out" "$WORK/out" > "$WORK/diff"; then
+		echo "ok    $name"
+	else
+		echo "FAIL  $name"
+		cat "$WORK/diff"
+		status=1
+	fi
+done
+exit $status
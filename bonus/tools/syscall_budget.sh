@@ -0,0 +1,74 @@
+#!/bin/sh
+# Checks the system calls minishell_bonus spends on five common command
+# shapes against a budget file, and fails if any of them went up by more
+# than SYSCALL_SLACK percent of its budget (10 by default, at least 2
+# calls), which absorbs the noise of libc and kernel versions.
+#
+# Each shape runs as the only line of a fresh shell, in a scratch directory
+# and with a fixed environment. Its cost is the count for that run minus the
+# count for an empty line, so start-up and exit are left out. Processes the
+# shell forks are counted until they execve, as the shell's own work.
+#
+# With "update" as a fourth argument, the budget file is rewritten with the
+# counts just measured instead (its comments are kept), for a change that
+# costs or saves system calls on purpose.
+#
+# usage: syscall_budget.sh shell counter budget_file [update]
+
+SHELL_BIN=$1
+COUNTER=$2
+BUDGET=$3
+MODE=$4
+SLACK=${SYSCALL_SLACK:-10}
+WORK=$(mktemp -d) || exit 1
+trap 'rm -rf "$WORK"' EXIT
+echo data > "$WORK/in"
+
+shape()
+{
+	case $1 in
+		empty) echo ;;
+		builtin) echo pwd ;;
+		external) echo true ;;
+		pipe3) echo 'echo a | cat | wc -l' ;;
+		redirect) echo 'cat < in > out' ;;
+		heredoc) printf 'cat << EOF\nx\nEOF\n' ;;
+	esac
+}
+
+count()
+{
+	shape "$1" > "$WORK/input"
+	(cd "$WORK" && env -i PATH=/usr/bin:/bin HOME="$WORK" TERM=dumb \
+		"$COUNTER" "$WORK/count" "$SHELL_BIN" < input > /dev/null 2>&1) \
+		|| return 1
+	cat "$WORK/count"
+}
+
+base=$(count empty) || { echo "syscall-budget: cannot trace $SHELL_BIN"; exit 1; }
+status=0
+while read -r name budget
+do
+	case $name in ''|\#*)
+		echo "$name${budget:+ $budget}" >> "$WORK/new"
+		continue ;;
+	esac
+	n=$(count "$name") || { echo "syscall-budget: $name: trace failed"; exit 1; }
+	n=$((n - base))
+	echo "$name $n" >> "$WORK/new"
+	slack=$((budget * SLACK / 100))
+	[ "$slack" -lt 2 ] && slack=2
+	if [ "$MODE" = update ]; then
+		verdict="was $budget"
+	elif [ "$n" -gt $((budget + slack)) ]; then
+		verdict="REGRESSION (+$((n - budget)), slack $slack)"
+		status=1
+	elif [ "$n" -lt $((budget - slack)) ]; then
+		verdict="ok, $((budget - n)) under: update the budget"
+	else
+		verdict=ok
+	fi
+	printf '%-10s %5d / %5d  %s\n' "$name" "$n" "$budget" "$verdict"
+done < "$BUDGET"
+[ "$MODE" = update ] && cp "$WORK/new" "$BUDGET"
+exit $status
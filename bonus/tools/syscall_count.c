@@ -0,0 +1,149 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   syscall_count.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: joneves- <joneves-@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by joneves-          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by joneves-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <errno.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/ptrace.h>
+#include <sys/wait.h>
+
+#define TRACE_OPTIONS (PTRACE_O_TRACESYSGOOD | PTRACE_O_TRACEFORK \
+	| PTRACE_O_TRACEVFORK | PTRACE_O_TRACECLONE | PTRACE_O_TRACEEXEC \
+	| PTRACE_O_EXITKILL)
+
+/**
+ * @brief Starts a command under ptrace, stopped right after its `execve`.
+ *
+ * Every `fork`, `vfork` and `clone` child is traced too (`TRACE_OPTIONS`).
+ * Nothing is counted before the command itself is running.
+ *
+ * @param argv The command and its arguments.
+ * @return The pid of the command, or -1 on error.
+ */
+static pid_t	ft_trace_start(char **argv)
+{
+	pid_t	pid;
+	int		status;
+
+	pid = fork();
+	if (pid == -1)
+		return (-1);
+	if (pid == 0)
+	{
+		ptrace(PTRACE_TRACEME, 0, NULL, NULL);
+		raise(SIGSTOP);
+		execvp(argv[0], argv);
+		perror(argv[0]);
+		_exit(127);
+	}
+	if (waitpid(pid, &status, 0) == -1
+		|| ptrace(PTRACE_SETOPTIONS, pid, NULL, TRACE_OPTIONS) == -1
+		|| ptrace(PTRACE_CONT, pid, NULL, 0) == -1
+		|| waitpid(pid, &status, 0) == -1
+		|| status >> 8 != (SIGTRAP | (PTRACE_EVENT_EXEC << 8)))
+		return (-1);
+	ptrace(PTRACE_SYSCALL, pid, NULL, 0);
+	return (pid);
+}
+
+/**
+ * @brief Handles one stop of a traced process.
+ *
+ * A system call is counted on entry. A process that calls `execve` is no
+ * longer the shell, so it is detached and what it runs is not counted.
+ * Trace stops are resumed silently; real signals are passed on.
+ *
+ * @param pid The stopped process.
+ * @param status The status reported by `waitpid`.
+ * @param count The running total of system calls.
+ */
+static void	ft_trace_stop(pid_t pid, int status, long *count)
+{
+	struct __ptrace_syscall_info	info;
+	int								sig;
+
+	sig = WSTOPSIG(status);
+	if (status >> 16 == PTRACE_EVENT_EXEC)
+	{
+		ptrace(PTRACE_DETACH, pid, NULL, 0);
+		return ;
+	}
+	if (sig == (SIGTRAP | 0x80))
+	{
+		if (ptrace(PTRACE_GET_SYSCALL_INFO, pid, sizeof(info), &info) > 0
+			&& info.op == PTRACE_SYSCALL_INFO_ENTRY)
+			(*count)++;
+		sig = 0;
+	}
+	else if (status >> 16 || sig == SIGSTOP || sig == SIGTRAP)
+		sig = 0;
+	ptrace(PTRACE_SYSCALL, pid, NULL, sig);
+}
+
+/**
+ * @brief Counts system calls until every traced process is gone.
+ *
+ * @return The number of system calls made, or -1 on error.
+ */
+static long	ft_trace_loop(void)
+{
+	long	count;
+	pid_t	pid;
+	int		status;
+
+	count = 0;
+	while (1)
+	{
+		pid = waitpid(-1, &status, __WALL);
+		if (pid == -1 && errno == EINTR)
+			continue ;
+		if (pid == -1)
+			break ;
+		if (WIFSTOPPED(status))
+			ft_trace_stop(pid, status, &count);
+	}
+	if (errno != ECHILD)
+		return (-1);
+	return (count);
+}
+
+/**
+ * @brief Counts the system calls a command makes, `strace -f -c` style.
+ *
+ * Usage: `syscall_count outfile command [args...]`. The command and every
+ * process it forks are followed until they exit or `execve` something
+ * else; the total is written to `outfile`, leaving the command's own
+ * standard streams untouched.
+ *
+ * @return 0 on success, 1 on error, 2 on a usage error.
+ */
+int	main(int argc, char **argv)
+{
+	FILE	*out;
+	long	count;
+
+	if (argc < 3)
+		return (fprintf(stderr, "usage: %s outfile command [args...]\n",
+				argv[0]), 2);
+	if (ft_trace_start(argv + 2) == -1)
+		return (perror("syscall_count"), 1);
+	count = ft_trace_loop();
+	if (count == -1)
+		return (perror("syscall_count"), 1);
+	out = fopen(argv[1], "w");
+	if (!out)
+		return (perror(argv[1]), 1);
+	fprintf(out, "%ld\n", count);
+	return (fclose(out) != 0);
+}
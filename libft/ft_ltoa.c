@@ -0,0 +1,54 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_ltoa.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: joneves- <joneves-@student.42porto.com>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by joneves-          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by joneves-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libft.h"
+
+static int	ft_longlen(unsigned long n, int neg)
+{
+	int	len;
+
+	len = neg;
+	if (n == 0)
+		return (1);
+	while (n != 0)
+	{
+		n /= 10;
+		++len;
+	}
+	return (len);
+}
+
+char	*ft_ltoa(long n)
+{
+	unsigned long	un;
+	int				len;
+	char			*res;
+
+	un = (unsigned long)n;
+	if (n < 0)
+		un = -un;
+	len = ft_longlen(un, n < 0);
+	res = (char *)malloc(sizeof(char) * (len + 1));
+	if (res == NULL)
+		return (NULL);
+	res[len] = '\0';
+	if (n < 0)
+		res[0] = '-';
+	if (un == 0)
+		res[0] = '0';
+	while (un != 0)
+	{
+		res[--len] = un % 10 + '0';
+		un /= 10;
+	}
+	return (res);
+}